@@ -0,0 +1,83 @@
+// 对比文本聊天消息的两条 JSON 处理路径：
+//   dom : nlohmann 解析成 DOM，取字段后再 dump 出应答（原实现）
+//   fast: FastJson（simdjson on-demand）只取路由字段，应答在原始消息体上补 error 字段
+// 用法：JsonParseBench [iterations]
+#include "FastJson.h"
+#include "const.h"
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static std::string MakeTextChat(int text_count, std::size_t content_len) {
+	json root;
+	root["fromuid"] = 1019;
+	root["touid"] = 1020;
+	json text_array = json::array();
+	for (int i = 0; i < text_count; ++i) {
+		text_array.push_back({
+			{"msgid", "3b1f2c4e-8a7d-4c1e-9f0b-" + std::to_string(100000000000 + i)},
+			{"content", std::string(content_len, 'a' + i % 26)}
+		});
+	}
+	root["text_array"] = std::move(text_array);
+	return root.dump();
+}
+
+static std::size_t DomPath(const std::string& data) {
+	json root = json::parse(data, nullptr, false);
+	json rtvalue;
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["fromuid"] = root.value("fromuid", 0);
+	rtvalue["touid"] = root.value("touid", 0);
+	json text_array = json::array();
+	for (const auto& txt_obj : root["text_array"]) {
+		text_array.push_back({
+			{"content", txt_obj.value("content", std::string{})},
+			{"msgid", txt_obj.value("msgid", std::string{})}
+		});
+	}
+	rtvalue["text_array"] = std::move(text_array);
+	return rtvalue.dump().size();
+}
+
+static std::size_t FastPath(const std::string& data) {
+	TextChatView view;
+	FastJson::ParseTextChat(data, view);
+	// 与 PayloadCodec::WithError 相同的拼接
+	std::string out = "{\"error\":0,";
+	out.append(data, 1, std::string::npos);
+	return out.size() + view.touid;
+}
+
+template <typename Fn>
+static double Run(const std::string& data, int iterations, Fn fn) {
+	std::size_t sink = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		sink += fn(data);
+	}
+	auto cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	if (sink == 0) {
+		std::printf("unexpected empty output\n");
+	}
+	return cost / iterations;
+}
+
+int main(int argc, char* argv[]) {
+	int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+	// 单条短消息、几条普通消息、一次粘贴的长消息，覆盖常见的负载大小
+	const int shapes[][2] = { {1, 16}, {1, 128}, {5, 64}, {20, 200}, {1, 1800} };
+
+	std::printf("%8s %8s %10s %12s %12s %8s\n", "texts", "chars", "bytes", "dom ns/op", "fast ns/op", "speedup");
+	for (const auto& shape : shapes) {
+		std::string data = MakeTextChat(shape[0], shape[1]);
+		// 和 LogicWorker 交给处理函数的消息体一样预留尾部空间
+		data.reserve(data.size() + JSON_PADDING);
+		double dom = Run(data, iterations, DomPath);
+		double fast = Run(data, iterations, FastPath);
+		std::printf("%8d %8d %10zu %12.1f %12.1f %7.2fx\n", shape[0], shape[1], data.size(), dom, fast, dom / fast);
+	}
+	return 0;
+}
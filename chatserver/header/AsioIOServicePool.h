@@ -13,6 +13,9 @@ public:
 	AsioIOServicePool(const AsioIOServicePool&) = delete;
 	AsioIOServicePool& operator=(const AsioIOServicePool&) = delete;
 	boost::asio::io_context& GetIOService();
+	boost::asio::io_context& GetIOService(std::size_t index);
+	std::size_t GetNextIndex();
+	std::size_t Size();
 	void Stop();
 private:
 	AsioIOServicePool(std::size_t size = std::thread::hardware_concurrency());
@@ -0,0 +1,30 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// 布隆过滤器：MayContain 返回 false 时一定没有插入过，返回 true 时有约 fp_rate 的概率误判。
+// 位数组按 64 位字原子置位，Add 和 MayContain 可以在不同线程并发调用；不支持删除，需要时整体重建
+class BloomFilter {
+public:
+	// 按预计元素个数和目标误判率确定位数和哈希个数
+	BloomFilter(std::size_t expected, double fp_rate);
+	void Add(uint64_t hash);
+	bool MayContain(uint64_t hash) const;
+	std::size_t GetCount() const;
+	std::size_t GetMemoryBytes() const;
+	int GetHashes() const;
+	// 按当前置位比例估算的误判率，插入数超过预计后会逐步变大
+	double EstimatedFpRate() const;
+	static uint64_t Hash(uint64_t key);
+	static uint64_t Hash(const std::string& key);
+private:
+	std::size_t _words;
+	std::size_t _bits;
+	int _hashes;
+	std::unique_ptr<std::atomic<uint64_t>[]> _data;
+	std::atomic<std::size_t> _count;
+	std::atomic<std::size_t> _set_bits;
+};
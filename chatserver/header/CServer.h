@@ -2,8 +2,10 @@
 #include <boost/asio.hpp>
 #include "CSession.h"
 #include <memory.h>
-#include <map>
 #include <mutex>
+#include "SessionTable.h"
+#include "HeartbeatWheel.h"
+#include <vector>
 #include <boost/asio/steady_timer.hpp>
 
 using boost::asio::ip::tcp;
@@ -14,18 +16,28 @@ public:
 	~CServer();
 	void ClearSession(std::string);
 	shared_ptr<CSession> GetSession(std::string);
-	bool CheckValid(std::string);
 	void on_timer(const boost::system::error_code& ec);
 	void StartTimer();
 	void StopTimer();
 private:
-	void HandleAccept(shared_ptr<CSession>, const boost::system::error_code & error);
-	void StartAccept();
+	void HandleAccept(shared_ptr<CSession>, std::size_t acceptor_index, std::size_t io_index,
+		const boost::system::error_code & error);
+	void StartAccept(std::size_t acceptor_index);
+	void StartOverloadTimer();
+	void OnOverloadTimer(const boost::system::error_code& ec);
+	void PublishLoad(bool overloaded);
 	boost::asio::io_context &_io_context;
 	short _port;
-	tcp::acceptor _acceptor;
-	std::map<std::string, shared_ptr<CSession>> _sessions;
-	std::mutex _mutex;
+	// 单 acceptor 模式只有一个，挂在主 io_context 上；
+	// ReusePort 模式下每个 AsioIOServicePool 的 io_context 各一个，下标一一对应
+	std::vector<std::unique_ptr<tcp::acceptor>> _acceptors;
+	bool _b_reuse_port;
+	SessionTable _sessions;
+	// 与 AsioIOServicePool 中的 io_context 一一对应
+	std::vector<std::shared_ptr<HeartbeatWheel>> _wheels;
 	boost::asio::steady_timer _timer;
+	// 暂停 accept 时用来延后重试，与 _acceptors 一一对应
+	std::vector<std::unique_ptr<boost::asio::steady_timer>> _accept_timers;
+	boost::asio::steady_timer _overload_timer;
 };
 
@@ -5,11 +5,22 @@
 #include <boost/beast/http.hpp>
 #include <boost/beast.hpp>
 #include <boost/asio.hpp>
-#include <queue>
+#include <deque>
 #include <mutex>
 #include <memory>
+#include <vector>
+#include <functional>
+#ifdef CHATSERVER_COROUTINE_SESSION
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#endif
 #include "const.h"
 #include "MsgNode.h"
+#include "MpscQueue.h"
+#include "MsgClass.h"
 using namespace std;
 
 
@@ -21,6 +32,7 @@ using tcp = boost::asio::ip::tcp;       // from <boost/asio/ip/tcp.hpp>
 
 class CServer;
 class LogicSystem;
+class LogicWorker;
 
 class CSession: public std::enable_shared_from_this<CSession>
 {
@@ -31,44 +43,109 @@ public:
 	std::string& GetSessionId();
 	void SetUserId(int uid);
 	int GetUserId();
+	// 由 session id 算出，LogicSystem 按它把消息分到固定的 worker
+	std::size_t GetRouteHash();
 	void Start();
 	void Send(char* msg,  short max_length, short msgid);
 	void Send(std::string msg, short msgid);
 	void Close();
 	std::shared_ptr<CSession> SharedSelf();
-	void AsyncReadBody(int length);
-	void AsyncReadHead(int total_len);
 	void NotifyOffline(int uid);
-	bool IsHeartbeatExpired(std::time_t& now);
+	int64_t GetLastHeartbeat();
 	void UpdateHeartbeat();
 	void DealExceptionSession();
+	static void GetWriteStats(uint64_t& write_count, uint64_t& write_frames);
+	std::size_t GetSendQueueBytes();
+	std::size_t GetSendQueuePeak();
+	uint64_t GetDroppedFrames();
+	static void GetSendQueueStats(uint64_t& queued_bytes, uint64_t& congested_sessions, uint64_t& dropped_frames);
+	// [SendQueue] LowWater 配置的低水位
+	static std::size_t GetSendLowWater();
+	// 某类别的帧从入队到开始写出的耗时，取走后清零
+	static LatencyStat TakeSendLatency(int cls);
+	void SetValid(bool valid);
+	bool IsValid();
+	// 登录时按登录包的编码确定，之后该会话的通知和应答都按此编码
+	void SetBinaryPayload(bool binary);
+	bool IsBinaryPayload();
 private:
-	void asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code& , std::size_t)> handler);
-	void asyncReadLen(std::size_t  read_len, std::size_t total_len,
-		std::function<void(const boost::system::error_code&, std::size_t)> handler);
-	
-	
+	boost::asio::mutable_buffer RecvWindow();
+	void AsyncRead();
+	void HandleRead(const boost::system::error_code& ec, std::size_t bytes_transfered,
+		std::shared_ptr<CSession> shared_self);
+	bool ParseFrames();
+	void ReplyBusy(short msg_id);
+	void PeekRecvBuf(std::size_t offset, char* dst, std::size_t len);
 	void HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self);
+	void EnqueueSend(std::shared_ptr<SendNode> node);
+	bool CoalesceSend(std::shared_ptr<SendNode>& node);
+	void KickSlowConsumer(const char* reason);
+	bool FillWriteBatch();
+	void AsyncWriteBatch();
+#ifdef CHATSERVER_COROUTINE_SESSION
+	boost::asio::awaitable<void> ReaderLoop(std::shared_ptr<CSession> self);
+	boost::asio::awaitable<void> WriterLoop(std::shared_ptr<CSession> self);
+	void WakeWriter();
+#endif
 	tcp::socket _socket;
 	std::string _session_id;
-	char _data[MAX_LENGTH];
+	std::size_t _route_hash;
+	char _recv_buf[RECV_BUF_SIZE];
+	std::size_t _recv_head;
+	std::size_t _recv_tail;
 	CServer* _server;
-	bool _b_close;
-	std::queue<shared_ptr<SendNode> > _send_que;
+	// 读写两条路径出错时都会关闭并清理会话，用 exchange 保证各只执行一次
+	std::atomic<bool> _b_close;
+	std::atomic<bool> _b_dealt;
+	// 发送队列按类别分开，写出时加权轮流取，控制类不排在批量消息后面
+	struct QueuedSend {
+		shared_ptr<SendNode> node;
+		int64_t enqueue_us;
+	};
+	std::deque<QueuedSend> _send_que[MSG_CLASS_COUNT];
 	std::mutex _send_lock;
-	std::shared_ptr<RecvNode> _recv_msg_node;
-	bool _b_head_parse;
-	std::shared_ptr<MsgNode> _recv_head_node;
+	bool _b_sending;
+	// 排队中加正在写的字节数，均在 _send_lock 下读写
+	std::size_t _send_bytes;
+	std::size_t _send_bytes_peak;
+	std::size_t _write_bytes;
+	bool _b_congested;
+	bool _b_kicked;
+	uint64_t _dropped_frames;
+	static std::atomic<uint64_t> _total_send_bytes;
+	static std::atomic<uint64_t> _congested_sessions;
+	static std::atomic<uint64_t> _total_dropped_frames;
+	std::vector<shared_ptr<SendNode> > _write_nodes;
+	std::vector<boost::asio::const_buffer> _write_bufs;
+	static std::atomic<uint64_t> _write_count;
+	static std::atomic<uint64_t> _write_frames;
+	static LatencyRecorder _send_latency[MSG_CLASS_COUNT];
+#ifdef CHATSERVER_COROUTINE_SESSION
+	boost::asio::steady_timer _write_signal;
+#endif
 	int _user_uid;
-	std::atomic<time_t> _last_heartbeat;
+	// 最近一次收到数据的时间，steady_clock 毫秒
+	std::atomic<int64_t> _last_heartbeat;
+	// 是否仍登记在 CServer 的会话表中，读路径无锁校验
+	std::atomic<bool> _b_valid;
+	std::atomic<bool> _b_binary_payload;
 	std::mutex _session_mtx;
 };
 
-class LogicNode {
+class LogicNode : public MpscHook {
 	friend class LogicSystem;
+	friend class LogicWorker;
 public:
 	LogicNode(shared_ptr<CSession>, shared_ptr<RecvNode>);
+	// 异步阶段完成后投回 worker 的续体，沿用发起该阶段的消息的类别
+	LogicNode(shared_ptr<CSession>, MsgClass, std::function<void()>);
 private:
 	shared_ptr<CSession> _session;
 	shared_ptr<RecvNode> _recvnode;
+	std::function<void()> _task;
+	MsgClass _class;
+	// 入队时间，微秒，用于统计各类别的排队耗时
+	int64_t _enqueue_us;
+	// 在 LogicWorker 的无锁队列中排队时指向自身，出队后释放
+	shared_ptr<LogicNode> _self_ref;
 };
@@ -38,8 +38,6 @@ public:
 	Status NotifyTextChatMsg(::grpc::ServerContext* context, 
 		const TextChatMsgReq* request, TextChatMsgRsp* response) override;
 
-	bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
-
 	Status NotifyKickUser(::grpc::ServerContext* context,
 		const KickUserReq* request, KickUserRsp* response) override;
 
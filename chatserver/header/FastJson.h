@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 一条文本聊天消息的只读视图。text 中的 string_view 指向当前线程解析器的字符串缓冲区，
+// 在同一线程下一次调用 FastJson 之前有效，需要跨阶段保存时应先拷贝
+struct TextChatView {
+	struct Text {
+		std::string_view msgid;
+		std::string_view content;
+	};
+	int fromuid = 0;
+	int touid = 0;
+	std::vector<Text> texts;
+};
+
+// 基于 simdjson on-demand 的热点消息解析，只取需要的字段，不构造 DOM。
+// 缺失的字段按 0 或空串处理，与 nlohmann 的 value() 默认值一致；字段类型不对时返回 false。
+// 文本聊天的消息体会被原样转发，ParseTextChat 额外要求每个值都解析过：
+// 出现未知字段或重复字段、text_array 元素格式不对、对象后还有多余内容时都返回 false。
+// data 尾部预留了 JSON_PADDING 的空间时直接在原缓冲区上解析，否则先拷贝一份
+class FastJson
+{
+public:
+	static bool ParseLogin(const std::string& data, int& uid, std::string& token);
+	static bool ParseHeartBeat(const std::string& data, int& fromuid);
+	static bool ParseTextChat(const std::string& data, TextChatView& view);
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <boost/asio.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "const.h"
+
+class CSession;
+
+// 单个 io_context 上的哈希时间轮，负责该线程上所有 session 的心跳超时。
+// 每个 session 只挂在一个槽里；槽到期时若期间有过心跳则按新的截止时间
+// 重新挂槽，否则判定超时。收到数据时只更新时间戳，不做任何挂槽操作。
+class HeartbeatWheel : public std::enable_shared_from_this<HeartbeatWheel>
+{
+public:
+	HeartbeatWheel(boost::asio::io_context& io_context);
+	void Start();
+	void Stop();
+	// 可跨线程调用，内部投递到所属 io_context
+	void Add(std::shared_ptr<CSession> session);
+	uint64_t GetExpiredCount();
+	static int64_t NowMs();
+private:
+	void OnTick(const boost::system::error_code& ec);
+	void Schedule(const std::shared_ptr<CSession>& session, int64_t deadline_ms);
+	void Expire(const std::shared_ptr<CSession>& session);
+	boost::asio::io_context& _io_context;
+	boost::asio::steady_timer _timer;
+	std::vector<std::vector<std::weak_ptr<CSession>>> _slots;
+	std::size_t _cur_slot;
+	int64_t _cur_tick_ms;
+	std::atomic<uint64_t> _expired_count;
+};
@@ -5,42 +5,103 @@
 #include "CSession.h"
 #include <queue>
 #include <map>
+#include <vector>
 #include <functional>
 #include "const.h"
 #include <unordered_map>
 #include "data.h"
+#include "PayloadCodec.h"
+#include "LogicWorker.h"
+#include "MsgDispatch.h"
+#include "OfflineInbox.h"
+#include "RedisMgr.h"
+#include "SingleFlight.h"
+#include "UserSearchIndex.h"
+#include <mutex>
+#include <chrono>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+// 一个异步阶段的累计耗时，从发起到 I/O 完成
+struct StageStat {
+	uint64_t count = 0;
+	uint64_t total_us = 0;
+	uint64_t max_us = 0;
+};
 
 class CServer;
-typedef  function<void(shared_ptr<CSession>, const short &msg_id, const string &msg_data)> FunCallBack;
+class LogicSystem;
+typedef void (LogicSystem::*MsgHandler)(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
+// 覆盖客户端协议的全部消息 id，下标即 msg_id - MSG_CHAT_LOGIN
+typedef MsgDispatchTable<MsgHandler, MSG_CHAT_LOGIN, ID_HEARTBEAT_RSP> LogicDispatchTable;
+
 class LogicSystem:public Singleton<LogicSystem>
 {
 	friend class Singleton<LogicSystem>;
+	friend class LogicWorker;
 public:
 	~LogicSystem();
-	void PostMsgToQue(shared_ptr < LogicNode> msg);
+	// 目标 worker 队列已满时返回 false
+	bool PostMsgToQue(shared_ptr < LogicNode> msg);
 	void SetServer(std::shared_ptr<CServer> pserver);
+	// CSession 在投递前用它过滤没有处理函数的消息
+	static bool IsKnownMsg(short msg_id);
+	// 每个 worker 当前排队的消息数，下标即 worker 编号
+	std::vector<std::size_t> GetQueueDepths();
+	// 单个 worker 每个类别的队列容量
+	std::size_t GetQueueCapacity();
+	// 各 worker 最近一批消息中最长的排队耗时，微秒
+	int64_t GetMaxQueueWaitUs();
+	// 因队列已满被拒绝的消息总数
+	uint64_t GetRejectedCount();
+	// 正在等待 I/O 的处理函数数量和各阶段耗时
+	uint64_t GetInflightCount();
+	// 某类别的消息在 worker 队列中的排队耗时，取走后清零
+	LatencyStat TakeQueueLatency(int cls);
+	std::map<std::string, StageStat> GetStageStats();
+	// 按名字搜索用户时回源 MySQL 的次数和被合并掉的次数
+	void GetNameLoadStats(uint64_t& loads, uint64_t& coalesced);
+	// 在 I/O 线程池上执行不需要回到 worker 的阻塞操作，供 IO 线程上的会话清理等调用，耗时计入 stage
+	void RunDetached(const char* stage, std::function<void()> io);
 private:
 	LogicSystem();
-	void DealMsg();
-	void RegisterCallBacks();
+	void Dispatch(std::shared_ptr<CSession> session, short msg_id, const string& msg_data);
+	// 处理函数的一个异步阶段：io 在 I/O 线程池执行，完成后 then 回到当前 worker 继续。
+	// 在途期间同一 session 的后续消息暂存，不在 worker 线程上调用时退化为同步执行
+	void Await(std::shared_ptr<CSession> session, const char* stage,
+		std::function<void()> io, std::function<void()> then);
+	// 与 Await 相同，只是等待的是定时器：delay 之后 then 回到当前 worker 继续，不占用 I/O 线程
+	void AwaitTimer(std::shared_ptr<CSession> session, std::chrono::milliseconds delay, std::function<void()> then);
+	void RecordStage(const char* stage, std::chrono::steady_clock::time_point start);
+	void LoadLoginInfo(int uid, const LoginBindResult& bind, ChatLoginRsp& rtvalue);
+	// 在 I/O 线程上执行：校验 token 并绑定 Redis、读取登录资料、更新本机映射，失败时 rtvalue 带错误码
+	bool BindLoginSession(std::shared_ptr<CSession> session, int uid, const std::string& token,
+		const std::string& server_name, LoginBindResult& bind, ChatLoginRsp& rtvalue);
+	// 登录后分页补发离线消息，acked 为上一次已下发的页
+	void DrainOfflineInbox(std::shared_ptr<CSession> session, int uid, std::shared_ptr<OfflinePage> acked);
+	// 发送队列降到低水位以下后下发一页并继续补发，waited_ms 为这一页已等待的时间
+	void SendOfflinePage(std::shared_ptr<CSession> session, int uid, std::shared_ptr<OfflinePage> page, int waited_ms);
 	void LoginHandler(shared_ptr<CSession> session, const short &msg_id, const string &msg_data);
 	void SearchInfo(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
 	void AddFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
 	void AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
 	void DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
-	void HeartBeatHandler(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
 	bool isPureDigit(const std::string& str);
 	void GetUserByUid(std::string uid_str, json& rtvalue);
 	void GetUserByName(std::string name, json& rtvalue);
-	bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo> &userinfo);
+	void FillSearchHits(const std::vector<SearchHit>& hits, json& rtvalue);
 	bool GetFriendApplyInfo(int to_uid, std::vector<std::shared_ptr<ApplyInfo>>& list);
 	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>> & user_list);
-	std::thread _worker_thread;
-	std::queue<shared_ptr<LogicNode>> _msg_que;
-	std::mutex _mutex;
-	std::condition_variable _consume;
-	bool _b_stop;
-	std::map<short, FunCallBack> _fun_callbacks;
+	void InvalidateFriendList(int uid, int touid);
+	static const LogicDispatchTable _dispatch;
+	std::vector<std::unique_ptr<LogicWorker>> _workers;
+	std::size_t _capacity;
+	std::unique_ptr<boost::asio::thread_pool> _io_pool;
+	// 析构时置位，之后不再接收客户端消息
+	std::atomic<bool> _b_stop;
+	std::mutex _stage_mtx;
+	std::map<std::string, StageStat> _stage_stats;
 	std::shared_ptr<CServer> _p_server;
+	SingleFlight<std::string, std::shared_ptr<UserInfo>> _name_loads;
 };
 
@@ -0,0 +1,78 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <condition_variable>
+#include <functional>
+#include "CSession.h"
+#include "MpscQueue.h"
+
+class LogicSystem;
+
+// 一个逻辑线程及其消息队列。同一个 session 的消息总是投到同一个 worker，保证处理顺序。
+// IO 线程无锁入队，worker 成批取出处理，只有队列为空时才睡眠等待唤醒。
+// 处理函数可以把阻塞 I/O 交给 LogicSystem 的 I/O 线程池（见 LogicSystem::Await），
+// 完成后续体以任务的形式投回原 worker；在途期间该 session 的后续消息暂存，保证顺序。
+// 控制类和批量类消息各有一个队列和容量，按 MsgClassWeights 加权轮流取出
+class LogicWorker
+{
+public:
+	LogicWorker(LogicSystem* logic, std::size_t capacity);
+	~LogicWorker();
+	// 消息所属类别的队列已满时返回 false，由调用方向客户端回复过载
+	bool PostMsgToQue(shared_ptr<LogicNode> msg);
+	std::size_t GetQueueDepth();
+	// 最近一次取出的批次中排队最久的消息等了多少微秒，队列为空时为 0
+	int64_t GetQueueWaitUs();
+	uint64_t GetRejectedCount();
+	// 当前线程所属的 worker，非 worker 线程返回 nullptr
+	static LogicWorker* Current();
+	// 以下两个只能在本 worker 线程上调用
+	void BeginAsync(const shared_ptr<CSession>& session);
+	// 当前正在处理的消息或续体的类别，发起异步阶段时续体沿用它
+	MsgClass GetCurrentClass();
+	// 任意线程可调用，续体不受队列容量限制，执行完后结束一次 BeginAsync
+	void PostTask(shared_ptr<CSession> session, MsgClass cls, std::function<void()> task);
+	static uint64_t GetInflightCount();
+	// 某类别的消息从入队到被 worker 取出的耗时，取走后清零
+	static LatencyStat TakeQueueLatency(int cls);
+private:
+	struct PendingSession {
+		int inflight = 0;
+		std::deque<shared_ptr<LogicNode>> deferred;
+	};
+	void Enqueue(shared_ptr<LogicNode> msg);
+	void EndAsync(const shared_ptr<CSession>& session);
+	void Dispatch(const shared_ptr<LogicNode>& msg_node);
+	void DealMsg();
+	void PopBatch(std::vector<shared_ptr<LogicNode>>& batch);
+	void WaitForMsg();
+	void Wake();
+	void HandleMsg(const shared_ptr<LogicNode>& msg_node);
+	LogicSystem* _logic;
+	MpscQueue<LogicNode> _msg_que[MSG_CLASS_COUNT];
+	// 已占用的队列名额，先于入队增加，出队后减少，暂存在 _pending 中的消息也计入；
+	// _depth 只统计还在无锁队列中的消息，用于睡眠判断
+	std::atomic<std::size_t> _class_depth[MSG_CLASS_COUNT];
+	std::atomic<std::size_t> _depth;
+	std::size_t _capacity;
+	MsgClass _current_class;
+	std::atomic<int64_t> _queue_wait_us;
+	static LatencyRecorder _queue_latency[MSG_CLASS_COUNT];
+	std::atomic<uint64_t> _rejected;
+	std::atomic<bool> _b_sleeping;
+	std::atomic<bool> _b_stop;
+	// 有异步阶段在途的 session，只在 worker 线程上访问
+	std::unordered_map<CSession*, PendingSession> _pending;
+	static std::atomic<uint64_t> _inflight_count;
+#ifdef __linux__
+	int _event_fd;
+#else
+	std::mutex _mutex;
+	std::condition_variable _consume;
+#endif
+	std::thread _worker_thread;
+};
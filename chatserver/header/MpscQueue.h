@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// 侵入式无锁多生产者单消费者队列（Vyukov 算法）。
+// 元素需继承 MpscHook，入队只做一次 exchange 和一次 store，不分配内存；
+// Pop 只能由唯一的消费者线程调用。
+struct MpscHook {
+	std::atomic<MpscHook*> _mpsc_next{ nullptr };
+};
+
+template <typename T>
+class MpscQueue
+{
+public:
+	MpscQueue() :_head(&_stub), _tail(&_stub) {}
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	// 任意线程可调用
+	void Push(T* node) {
+		Link(static_cast<MpscHook*>(node));
+	}
+
+	// 仅消费者线程调用。队列为空或有生产者正处于入队中途时返回 nullptr
+	T* Pop() {
+		MpscHook* tail = _tail;
+		MpscHook* next = tail->_mpsc_next.load(std::memory_order_acquire);
+		if (tail == &_stub) {
+			if (next == nullptr) {
+				return nullptr;
+			}
+			_tail = next;
+			tail = next;
+			next = next->_mpsc_next.load(std::memory_order_acquire);
+		}
+
+		if (next != nullptr) {
+			_tail = next;
+			return static_cast<T*>(tail);
+		}
+
+		// tail 是最后一个节点，若 head 已经前移说明有生产者还没链上
+		if (tail != _head.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+
+		// 把 stub 放回队尾，才能把最后一个真实节点摘下来
+		Link(&_stub);
+		next = tail->_mpsc_next.load(std::memory_order_acquire);
+		if (next != nullptr) {
+			_tail = next;
+			return static_cast<T*>(tail);
+		}
+		return nullptr;
+	}
+
+private:
+	void Link(MpscHook* node) {
+		node->_mpsc_next.store(nullptr, std::memory_order_relaxed);
+		MpscHook* prev = _head.exchange(node, std::memory_order_acq_rel);
+		prev->_mpsc_next.store(node, std::memory_order_release);
+	}
+
+	// 生产者只写 _head，消费者只写 _tail，分开放避免伪共享
+	alignas(64) std::atomic<MpscHook*> _head;
+	alignas(64) MpscHook* _tail;
+	MpscHook _stub;
+};
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "const.h"
+
+// 消息优先级类别。控制类是登录、踢下线和心跳，量小但客户端在等，超时就会重连；
+// 其余聊天、通知和好友消息都是批量类。逻辑 worker 和会话发送队列都按类别分队列，加权轮流取
+enum MsgClass {
+	MsgClassControl = 0,
+	MsgClassBulk = 1,
+	MSG_CLASS_COUNT = 2,
+};
+
+inline MsgClass MsgClassOf(short msg_id) {
+	switch (msg_id) {
+	case MSG_CHAT_LOGIN:
+	case MSG_CHAT_LOGIN_RSP:
+	case ID_NOTIFY_OFF_LINE_REQ:
+	case ID_HEART_BEAT_REQ:
+	case ID_HEARTBEAT_RSP:
+		return MsgClassControl;
+	default:
+		return MsgClassBulk;
+	}
+}
+
+inline const char* MsgClassName(int cls) {
+	return cls == MsgClassControl ? "control" : "bulk";
+}
+
+// 每轮从各类别队列中最多取出的条数，可在 config.ini 的 [Priority] ControlWeight/BulkWeight 中覆盖
+const int* MsgClassWeights();
+
+struct LatencyStat {
+	uint64_t count = 0;
+	uint64_t total_us = 0;
+	uint64_t max_us = 0;
+};
+
+// 无锁的排队耗时统计，任意线程记录，定时器取走并清零，看的是最近一个周期
+class LatencyRecorder {
+public:
+	LatencyRecorder() :_count(0), _total_us(0), _max_us(0) {}
+
+	void Record(uint64_t cost_us) {
+		_count.fetch_add(1, std::memory_order_relaxed);
+		_total_us.fetch_add(cost_us, std::memory_order_relaxed);
+		uint64_t max_us = _max_us.load(std::memory_order_relaxed);
+		while (cost_us > max_us && !_max_us.compare_exchange_weak(max_us, cost_us, std::memory_order_relaxed)) {
+		}
+	}
+
+	LatencyStat Take() {
+		LatencyStat stat;
+		stat.count = _count.exchange(0, std::memory_order_relaxed);
+		stat.total_us = _total_us.exchange(0, std::memory_order_relaxed);
+		stat.max_us = _max_us.exchange(0, std::memory_order_relaxed);
+		return stat;
+	}
+
+	static int64_t NowUs() {
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+private:
+	std::atomic<uint64_t> _count;
+	std::atomic<uint64_t> _total_us;
+	std::atomic<uint64_t> _max_us;
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+// 消息 id 到处理函数的稠密表，按 msg_id - MinId 直接下标查找。
+// 表由注册列表在编译期构造，处理函数以函数指针或成员函数指针保存，调用不经过 std::function。
+// 注册了范围外的 id 或重复注册同一个 id 时，常量求值失败，编译报错
+template <typename Handler, short MinId, short MaxId>
+class MsgDispatchTable
+{
+public:
+	struct Route {
+		short msg_id;
+		Handler handler;
+	};
+
+	constexpr MsgDispatchTable(std::initializer_list<Route> routes) :_handlers{} {
+		for (const auto& route : routes) {
+			if (!InRange(route.msg_id) || _handlers[Index(route.msg_id)] != nullptr) {
+				throw "invalid or duplicate msg id in dispatch table";
+			}
+			_handlers[Index(route.msg_id)] = route.handler;
+		}
+	}
+
+	constexpr Handler Find(short msg_id) const {
+		return InRange(msg_id) ? _handlers[Index(msg_id)] : nullptr;
+	}
+
+	constexpr bool Contains(short msg_id) const {
+		return Find(msg_id) != nullptr;
+	}
+
+private:
+	static constexpr bool InRange(short msg_id) {
+		return msg_id >= MinId && msg_id <= MaxId;
+	}
+
+	static constexpr std::size_t Index(short msg_id) {
+		return static_cast<std::size_t>(msg_id - MinId);
+	}
+
+	std::array<Handler, MaxId - MinId + 1> _handlers;
+};
@@ -3,24 +3,25 @@
 #include "const.h"
 #include <iostream>
 #include <boost/asio.hpp>
+#include "MsgNodePool.h"
 using namespace std;
 using boost::asio::ip::tcp;
 class LogicSystem;
+class LogicWorker;
 class MsgNode
 {
 public:
+	// 缓冲区从池里取，不做清零，只保证末尾的 '\0'
 	MsgNode(short max_len) :_total_len(max_len), _cur_len(0) {
-		_data = new char[_total_len + 1]();
+		_data = MsgNodePool::Inst().Alloc(_total_len + 1);
 		_data[_total_len] = '\0';
 	}
 
 	~MsgNode() {
-		std::cout << "destruct MsgNode" << endl;
-		delete[] _data;
+		MsgNodePool::Inst().Free(_data, _total_len + 1);
 	}
 
 	void Clear() {
-		::memset(_data, 0, _total_len);
 		_cur_len = 0;
 	}
 
@@ -31,6 +32,8 @@ public:
 
 class RecvNode :public MsgNode {
 	friend class LogicSystem;
+	friend class LogicWorker;
+	friend class LogicNode;
 public:
 	RecvNode(short max_len, short msg_id);
 private:
@@ -39,6 +42,7 @@ private:
 
 class SendNode:public MsgNode {
 	friend class LogicSystem;
+	friend class CSession;
 public:
 	SendNode(const char* msg,short max_len, short msg_id);
 private:
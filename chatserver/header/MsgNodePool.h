@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// 消息节点及其数据缓冲区的分级内存池。
+// 每个 io 线程（即每个 io_context）持有一份线程本地空闲链表，
+// 本地链表过长时批量归还到全局仓库，本地为空时再从全局批量取回，
+// 稳态下收发消息不再走 malloc。
+class MsgNodePool
+{
+public:
+	static MsgNodePool& Inst();
+	~MsgNodePool();
+	char* Alloc(std::size_t size);
+	void Free(char* ptr, std::size_t size);
+	void GetStats(uint64_t& alloc_count, uint64_t& malloc_count, uint64_t& oversize_count);
+
+	static const std::size_t CLASS_COUNT = 5;
+	static const std::size_t LOCAL_CACHE_MAX = 256;
+	static const std::size_t TRANSFER_BATCH = 64;
+	static std::size_t ClassIndex(std::size_t size);
+	static std::size_t ClassSize(std::size_t index);
+
+	struct LocalCache;
+	void Refill(std::size_t index, std::vector<char*>& local);
+	void Release(std::size_t index, std::vector<char*>& local, std::size_t count);
+private:
+	MsgNodePool() = default;
+	std::mutex _depot_mtx[CLASS_COUNT];
+	std::vector<char*> _depot[CLASS_COUNT];
+	std::atomic<uint64_t> _alloc_count{ 0 };
+	std::atomic<uint64_t> _malloc_count{ 0 };
+	std::atomic<uint64_t> _oversize_count{ 0 };
+};
+
+// 供 std::allocate_shared 使用，让节点对象和控制块也从池里分配
+template <typename T>
+class MsgPoolAllocator {
+public:
+	using value_type = T;
+	MsgPoolAllocator() = default;
+	template <typename U>
+	MsgPoolAllocator(const MsgPoolAllocator<U>&) {}
+
+	T* allocate(std::size_t n) {
+		return reinterpret_cast<T*>(MsgNodePool::Inst().Alloc(n * sizeof(T)));
+	}
+
+	void deallocate(T* p, std::size_t n) {
+		MsgNodePool::Inst().Free(reinterpret_cast<char*>(p), n * sizeof(T));
+	}
+
+	template <typename U>
+	bool operator==(const MsgPoolAllocator<U>&) const { return true; }
+	template <typename U>
+	bool operator!=(const MsgPoolAllocator<U>&) const { return false; }
+};
+
+template <typename T, typename... Args>
+std::shared_ptr<T> MakePooled(Args&&... args) {
+	return std::allocate_shared<T>(MsgPoolAllocator<T>(), std::forward<Args>(args)...);
+}
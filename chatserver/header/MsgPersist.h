@@ -0,0 +1,72 @@
+#pragma once
+#include "Singleton.h"
+#include "const.h"
+#include "MysqlDao.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 一条待落库的文本聊天消息
+struct ChatRecord {
+	ChatRecord() :fromuid(0), touid(0), send_time(0) {}
+	int fromuid;
+	int touid;
+	std::string msgid;
+	std::string content;
+	// 服务器收到消息的时间，毫秒
+	long long send_time;
+};
+
+struct PersistStat {
+	uint64_t backlog = 0;
+	uint64_t rows = 0;
+	uint64_t flushes = 0;
+	uint64_t flush_total_us = 0;
+	uint64_t flush_max_us = 0;
+	uint64_t rejected = 0;
+	uint64_t failed = 0;
+};
+
+// 聊天记录异步落库。处理函数只把消息放进缓冲区，写线程攒够 BatchSize 条或等满 FlushIntervalMs
+// 后在独占的 MySQL 连接上用多行 INSERT 成组提交，一次事务一次刷盘：
+//   CREATE TABLE chat_msg (id BIGINT AUTO_INCREMENT PRIMARY KEY, msg_id VARCHAR(64) NOT NULL,
+//     from_uid INT NOT NULL, to_uid INT NOT NULL, content TEXT NOT NULL, send_time DATETIME(3) NOT NULL,
+//     UNIQUE KEY uk_msg_id (msg_id), KEY idx_pair_time (from_uid, to_uid, send_time));
+// 积压超过 MaxBacklog 时拒绝入队，由调用方给发送方回 ServerBusy，MySQL 跟不上时压力回传到客户端
+class MsgPersist :public Singleton<MsgPersist>
+{
+	friend class Singleton<MsgPersist>;
+public:
+	~MsgPersist();
+	// 一次请求中的多条消息整体入队或整体拒绝，任意线程可调用
+	bool Enqueue(std::vector<ChatRecord>&& records);
+	// 写完缓冲区中剩余的消息后停止写线程
+	void Close();
+	PersistStat GetStats();
+	static long long NowMs();
+private:
+	MsgPersist();
+	void Run();
+	void Flush(std::vector<ChatRecord>& batch);
+	bool InsertBatch(const std::vector<ChatRecord>& batch);
+	std::unique_ptr<MySqlPool> _pool;
+	std::size_t _batch_size;
+	int _flush_interval_ms;
+	std::size_t _max_backlog;
+	std::mutex _mtx;
+	std::condition_variable _cond;
+	std::vector<ChatRecord> _buffer;
+	bool _b_stop;
+	std::thread _thread;
+	// 缓冲区中加正在写入的条数
+	std::atomic<uint64_t> _backlog;
+	std::atomic<uint64_t> _rows;
+	std::atomic<uint64_t> _flushes;
+	std::atomic<uint64_t> _flush_total_us;
+	std::atomic<uint64_t> _flush_max_us;
+	std::atomic<uint64_t> _rejected;
+	std::atomic<uint64_t> _failed;
+};
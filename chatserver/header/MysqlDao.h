@@ -235,6 +235,14 @@ public:
 	std::shared_ptr<UserInfo> GetUser(std::string name);
 	bool GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int offset, int limit );
 	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info);
+	// 按 uid 升序取 uid 大于 after_uid 的最多 limit 个用户的公开资料，用于分批构建搜索索引
+	bool GetUsersAfter(int after_uid, int limit, std::vector<std::shared_ptr<UserInfo> >& users);
+	// 同上，只取 uid 和用户名，用于重建存在性过滤器
+	bool GetUserKeysAfter(int after_uid, int limit, std::vector<std::pair<int, std::string> >& keys);
+	// 离线消息持久层，返回自增 id，失败返回 -1
+	long long AddOfflineMsg(int uid, int msg_id, const std::string& payload, int ttl_sec);
+	bool GetOfflineMsgs(int uid, long long after_id, long long before_id, int limit, std::vector<OfflineMsg>& msgs);
+	bool DelOfflineMsgs(int uid, long long max_id);
 private:
 	std::unique_ptr<MySqlPool> pool_;
 };
@@ -20,6 +20,11 @@ public:
 	std::shared_ptr<UserInfo> GetUser(std::string name);
 	bool GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int begin, int limit=10);
 	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info);
+	bool GetUsersAfter(int after_uid, int limit, std::vector<std::shared_ptr<UserInfo> >& users);
+	bool GetUserKeysAfter(int after_uid, int limit, std::vector<std::pair<int, std::string> >& keys);
+	long long AddOfflineMsg(int uid, int msg_id, const std::string& payload, int ttl_sec);
+	bool GetOfflineMsgs(int uid, long long after_id, long long before_id, int limit, std::vector<OfflineMsg>& msgs);
+	bool DelOfflineMsgs(int uid, long long max_id);
 private:
 	MysqlMgr();
 	MysqlDao  _dao;
@@ -0,0 +1,44 @@
+#pragma once
+#include "Singleton.h"
+#include "const.h"
+#include "data.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+// 收件箱中取出的一页，条目已编码成 {"id":N,"msgid":M,"body":{...}}，可直接拼进批量帧
+struct OfflinePage {
+	std::vector<std::string> entries;
+	long long max_id = 0;
+	// 来自 Redis 列表时确认需要裁掉列表头部
+	bool from_redis = false;
+};
+
+// 每个用户一个离线收件箱。Redis 列表 offline_<uid> 是热层，长度和过期时间受限；
+// MySQL 表 offline_msg 是持久层，被热层裁掉或过期丢失的消息从这里补齐：
+//   CREATE TABLE offline_msg (id BIGINT AUTO_INCREMENT PRIMARY KEY, uid INT NOT NULL, msg_id INT NOT NULL,
+//     payload TEXT NOT NULL, expire_time DATETIME NOT NULL, KEY idx_uid_id (uid, id));
+// 所有接口都会访问 Redis 和 MySQL，只能在 I/O 线程上调用
+class OfflineInbox :public Singleton<OfflineInbox>
+{
+	friend class Singleton<OfflineInbox>;
+public:
+	// 对端不在线时调用，json_body 是对应通知的 JSON 消息体
+	bool Push(int touid, short msg_id, const std::string& json_body);
+	// 按 id 从小到大取下一页，id 不超过 after_id 的持久层消息视为已投递
+	bool Fetch(int uid, long long after_id, OfflinePage& page);
+	// 一页已下发后从两层中删除，失败时应停止补发，避免重复投递
+	bool Ack(int uid, const OfflinePage& page);
+	// 按 OFFLINE_FRAME_BYTES 把一页拆成若干 ID_NOTIFY_OFFLINE_MSG_BATCH 帧：{"error":0,"msgs":[...]}
+	static std::vector<std::string> EncodeFrames(const OfflinePage& page);
+	void GetStats(uint64_t& pushed, uint64_t& delivered);
+private:
+	OfflineInbox();
+	static std::string MakeEntry(long long id, short msg_id, const std::string& json_body);
+	static long long EntryId(const std::string& entry);
+	int _max_size;
+	int _ttl;
+	int _batch_size;
+	std::atomic<uint64_t> _pushed;
+	std::atomic<uint64_t> _delivered;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include "Singleton.h"
+#include "const.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+struct OverloadStat {
+	bool b_overloaded = false;
+	bool b_accept_paused = false;
+	uint64_t overload_enters = 0;
+	uint64_t paused_accepts = 0;
+	uint64_t shed_search = 0;
+	uint64_t shed_add_friend = 0;
+};
+
+// 准入控制。CServer 定时采样逻辑队列深度、队首排队耗时和连接数：
+// 任一超过高水位进入过载，全部降到低水位（高水位的一半）以下才解除，避免来回抖动。
+// 过载期间暂停 accept，搜索和加好友这类要查 MySQL 的请求在 IO 线程直接回 ServerBusy，
+// 登录、心跳和聊天照常处理；连接数超过上限时只暂停 accept。
+// 过载状态写入 Redis 的 SERVER_LOAD，StatusServer 分配服务器时跳过过载的节点
+class OverloadGuard :public Singleton<OverloadGuard>
+{
+	friend class Singleton<OverloadGuard>;
+public:
+	~OverloadGuard();
+	// 定时器调用，重新计算过载状态，状态发生变化时返回 true
+	bool Evaluate(std::size_t session_count);
+	// IO 线程调用，过载时拒绝代价高的请求并计数
+	bool Admit(short msg_id);
+	bool IsOverloaded();
+	bool AcceptPaused();
+	void CountPausedAccept();
+	int GetCheckIntervalMs();
+	int GetAcceptRetryMs();
+	OverloadStat GetStats();
+private:
+	OverloadGuard();
+	std::size_t _queue_high_percent;
+	int64_t _queue_wait_high_us;
+	std::size_t _max_connections;
+	int _check_interval_ms;
+	int _accept_retry_ms;
+	std::atomic<bool> _b_overloaded;
+	std::atomic<bool> _b_accept_paused;
+	std::atomic<uint64_t> _overload_enters;
+	std::atomic<uint64_t> _paused_accepts;
+	std::atomic<uint64_t> _shed_search;
+	std::atomic<uint64_t> _shed_add_friend;
+};
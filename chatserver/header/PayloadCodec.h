@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include "const.h"
+#include "message.pb.h"
+
+using message::ChatLoginReq;
+using message::ChatLoginRsp;
+using message::ChatUserInfo;
+using message::TextChatMsgReq;
+using message::TextChatMsgRsp;
+using message::TextChatData;
+using message::AddFriendNotify;
+using message::AuthFriendNotify;
+using message::KickUserRsp;
+using message::HeartBeatReq;
+using message::HeartBeatRsp;
+
+// 客户端消息体的编解码。JSON 会话保持原有字段名不变，
+// 二进制会话直接使用 message.proto 中的定义，业务逻辑只处理 protobuf 对象。
+// 登录、心跳和文本聊天三类热点请求的 JSON 解码走 FastJson（simdjson on-demand）。
+class PayloadCodec
+{
+public:
+	// 登录包首个非空白字符不是 '{' 时视为 protobuf 编码
+	static bool IsBinaryLogin(const std::string& data);
+
+	static bool Decode(const std::string& data, bool binary, ChatLoginReq& req);
+	static bool Decode(const std::string& data, bool binary, TextChatMsgReq& req);
+	static bool Decode(const std::string& data, bool binary, HeartBeatReq& req);
+
+	static std::string Encode(const ChatLoginRsp& rsp, bool binary);
+	static std::string Encode(const TextChatMsgRsp& rsp, bool binary);
+	static std::string Encode(const AddFriendNotify& notify, bool binary);
+	static std::string Encode(const AuthFriendNotify& notify, bool binary);
+	static std::string Encode(const KickUserRsp& notify, bool binary);
+	static std::string Encode(const HeartBeatRsp& rsp, bool binary);
+	// 只带错误码的应答。各应答消息的 error 都是 1 号字段，二进制编码可通用
+	static std::string EncodeError(int error, bool binary);
+	// 在一个已校验过的 JSON 对象最前面加上 error 字段，其余内容原样保留，用于转发时免去重新序列化。
+	// 调用方需保证对象内没有 error 字段（FastJson::ParseTextChat 会拒绝未知字段）
+	static std::string WithError(const std::string& json_obj, int error);
+};
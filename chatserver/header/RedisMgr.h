@@ -6,6 +6,11 @@
 #include <mutex>
 #include "Singleton.h"
 #include <cstring>
+#include <vector>
+#include <map>
+#include <string>
+#include <thread>
+#include <functional>
 class RedisConPool {
 public:
 	RedisConPool(size_t poolSize, const char* host, int port, const char* pwd)
@@ -253,6 +258,28 @@ private:
 	int counter_;
 };
 
+// 流水线和脚本返回的一条应答，拷贝自 redisReply，可在归还连接后使用
+struct RedisValue {
+	int type = REDIS_REPLY_NIL;
+	long long integer = 0;
+	std::string str;
+	std::vector<RedisValue> elements;
+	bool IsNil() const { return type == REDIS_REPLY_NIL; }
+	bool IsError() const { return type == REDIS_REPLY_ERROR; }
+};
+
+// 登录脚本的结果，error 取值同 ErrorCodes
+struct LoginBindResult {
+	int error = 0;
+	// 绑定前该用户所在的服务器和会话 id
+	bool b_old = false;
+	std::string old_server;
+	std::string old_session;
+	// ubaseinfo_ 缓存，未命中时 b_base 为 false
+	bool b_base = false;
+	std::string base_info;
+};
+
 class RedisMgr: public Singleton<RedisMgr>, 
 	public std::enable_shared_from_this<RedisMgr>
 {
@@ -265,13 +292,36 @@ public:
 	bool LPop(const std::string &key, std::string& value);
 	bool RPush(const std::string& key, const std::string& value);
 	bool RPop(const std::string& key, std::string& value);
+	// RPUSH 后裁剪到最多 max_len 个元素并刷新过期时间，三条命令走同一次流水线
+	bool RPushCapped(const std::string& key, const std::string& value, int max_len, int ttl_sec);
+	// 键不存在时返回 true 且 values 为空
+	bool LRange(const std::string& key, int start, int stop, std::vector<std::string>& values);
+	bool LTrim(const std::string& key, int start, int stop);
+	// 在同一连接上一次写出全部命令再依次读回应答，只占一次网络往返。
+	// 每条命令按参数拆开，参数按二进制安全方式发送；连接出错时返回 false
+	bool Pipeline(const std::vector<std::vector<std::string>>& cmds, std::vector<RedisValue>& replies);
+	// 以 EVALSHA 执行脚本，脚本首次使用或 Redis 重启后自动 SCRIPT LOAD
+	bool EvalScript(const std::string& script, const std::vector<std::string>& keys,
+		const std::vector<std::string>& args, RedisValue& reply);
+	// 一次往返内校验 token、取出旧的登录位置并绑定到本服务器，同时带回用户基础信息缓存
+	bool LoginBind(int uid, const std::string& token, const std::string& server_name,
+		const std::string& session_id, LoginBindResult& result);
+	// 登录后续步骤失败时撤销 LoginBind：仅当 usession_ 仍是该会话时恢复绑定前的值
+	bool RollbackBind(int uid, const std::string& session_id, const LoginBindResult& bind);
+	// 仅当 usession_ 仍是该会话时删除 usession_ 和 uip_，避免误删新登录的绑定
+	bool UnbindSession(int uid, const std::string& session_id);
 	bool HSet(const std::string &key, const std::string  &hkey, const std::string &value);
 	bool HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen);
 	std::string HGet(const std::string &key, const std::string &hkey);
 	bool HDel(const std::string& key, const std::string& field);
 	bool Del(const std::string &key);
 	bool ExistsKey(const std::string &key);
+	// 在独占连接上订阅频道，每个频道一个线程。on_message 在订阅线程上调用；
+	// 连接建立和断线重连后调用 on_connect，断线期间的消息已丢失，由调用方自行补偿
+	void Subscribe(const std::string& channel, std::function<void(const std::string&)> on_message,
+		std::function<void()> on_connect);
 	void Close() {
+		StopSubscribers();
 		_con_pool->Close();
 		_con_pool->ClearConnections();
 	}
@@ -288,6 +338,20 @@ public:
 	void DelCount(std::string server_name);
 private:
 	RedisMgr();
+	// [Redis] PoolSize，未配置时按 I/O 线程数和 worker 数推算
+	static std::size_t GetPoolSize();
+	redisContext* ConnectSubscriber(const std::string& channel);
+	void StopSubscribers();
 	unique_ptr<RedisConPool>  _con_pool;
+	std::string _host;
+	int _port;
+	std::string _pwd;
+	std::atomic<bool> _b_sub_stop;
+	std::mutex _sub_mtx;
+	std::vector<std::string> _sub_channels;
+	std::vector<std::thread> _sub_threads;
+	// 脚本内容到 SHA1 的缓存
+	std::mutex _script_mtx;
+	std::map<std::string, std::string> _script_shas;
 };
 
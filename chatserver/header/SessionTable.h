@@ -0,0 +1,27 @@
+#pragma once
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "const.h"
+
+class CSession;
+
+// 按 session id 哈希分片的会话表，每个分片一把锁，
+// 插入/删除/查找只锁对应分片，统计总数时逐个分片加锁。
+class SessionTable
+{
+public:
+	void Insert(const std::string& session_id, std::shared_ptr<CSession> session);
+	std::shared_ptr<CSession> Erase(const std::string& session_id);
+	std::shared_ptr<CSession> Find(const std::string& session_id);
+	std::size_t Size();
+private:
+	struct Shard {
+		std::mutex _mutex;
+		std::unordered_map<std::string, std::shared_ptr<CSession>> _sessions;
+	};
+	Shard& GetShard(const std::string& session_id);
+	std::array<Shard, SESSION_SHARD_COUNT> _shards;
+};
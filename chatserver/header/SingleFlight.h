@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+// 合并同一个 key 上并发的加载。第一个调用者执行 fn，加载期间同 key 的其他调用者等待并共享
+// 它的结果（或异常），加载结束后立即移除，之后的调用会重新加载，不缓存结果。
+// 用于缓存未命中时回源 MySQL，避免 Redis 清空或切换后大量请求同时打到数据库
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class SingleFlight
+{
+public:
+	SingleFlight() :_loads(0), _shared(0) {}
+	SingleFlight(const SingleFlight&) = delete;
+	SingleFlight& operator=(const SingleFlight&) = delete;
+
+	Value Do(const Key& key, const std::function<Value()>& fn) {
+		std::promise<Value> promise;
+		std::shared_future<Value> future;
+		bool b_leader = false;
+		{
+			std::lock_guard<std::mutex> lock(_mtx);
+			auto iter = _calls.find(key);
+			if (iter != _calls.end()) {
+				future = iter->second;
+			}
+			else {
+				future = promise.get_future().share();
+				_calls.emplace(key, future);
+				b_leader = true;
+			}
+		}
+
+		// 已有同 key 的加载在进行，在锁外等它的结果
+		if (!b_leader) {
+			_shared++;
+			return future.get();
+		}
+		_loads++;
+
+		try {
+			Value value = fn();
+			Finish(key);
+			promise.set_value(value);
+			return value;
+		}
+		catch (...) {
+			Finish(key);
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+	}
+
+	// 实际执行的加载次数和被合并掉的调用次数
+	void GetStats(uint64_t& loads, uint64_t& shared) {
+		loads = _loads;
+		shared = _shared;
+	}
+
+private:
+	void Finish(const Key& key) {
+		std::lock_guard<std::mutex> lock(_mtx);
+		_calls.erase(key);
+	}
+
+	std::mutex _mtx;
+	std::unordered_map<Key, std::shared_future<Value>, Hash> _calls;
+	std::atomic<uint64_t> _loads;
+	std::atomic<uint64_t> _shared;
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include "Singleton.h"
+#include "const.h"
+#include "BloomFilter.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct UserFilterStat {
+	bool b_ready = false;
+	uint64_t users = 0;
+	int max_uid = 0;
+	uint64_t memory_bytes = 0;
+	double estimated_fp_rate = 0;
+	uint64_t rebuilds = 0;
+	uint64_t checks = 0;
+	// 过滤器判定不存在、直接返回的次数
+	uint64_t rejected = 0;
+	// 过滤器放行但 MySQL 中查不到的次数，与 rejected 一起算出实际误判率
+	uint64_t false_positives = 0;
+};
+
+// 已存在的 uid 和用户名的布隆过滤器，位于 UserInfoCache 和按名字查询之前，
+// 判定不存在时直接返回，不访问 Redis 和 MySQL，挡住扫号和输错的查询。
+// 后台线程按 uid 分批读取全部 uid 和用户名整体重建，每 RebuildSec 秒一次，订阅断线重连后也重建一次；
+// 两次重建之间 gateserver 注册成功后在 USER_PROFILE_CHANNEL 上广播 "uid|name"，收到后增量插入。
+// 为避免漏掉广播导致把存在的用户判成不存在：大于上次重建时最大 uid 的查询一律放行；
+// 用户名与 MySQL 的比较规则一致，只对 ASCII 名字转小写、去掉末尾空格后判定，其余名字一律放行。
+// 排序规则忽略重音，"jose" 能查到 "josé"：已有用户名中只要有一个非 ASCII 且可能与 ASCII 名字相等
+// （不含汉字、假名、谚文等），该过滤器就不再拒绝任何名字，只保留 uid 判定
+class UserExistFilter :public Singleton<UserExistFilter>
+{
+	friend class Singleton<UserExistFilter>;
+public:
+	~UserExistFilter();
+	void Start();
+	void Stop();
+	// 返回 false 时该 uid 一定不存在；首轮重建完成前总是返回 true
+	bool MayHaveUid(int uid);
+	bool MayHaveName(const std::string& name);
+	// 放行后回源确认不存在时调用，用于统计实际误判率，未经过滤器判定的查询不计入
+	void CountFalsePositive(int uid);
+	void CountFalsePositive(const std::string& name);
+	UserFilterStat GetStats();
+private:
+	UserExistFilter();
+	struct Filters {
+		Filters(std::size_t expected, double fp_rate) :uids(expected, fp_rate), names(expected, fp_rate), max_uid(0),
+			b_name_check(true) {}
+		BloomFilter uids;
+		BloomFilter names;
+		int max_uid;
+		// 插入过可能按排序规则等于某个 ASCII 名字的非 ASCII 名字后置为 false
+		std::atomic<bool> b_name_check;
+	};
+	static bool NameKey(const std::string& name, std::string& key);
+	static bool MayEqualAscii(const std::string& name);
+	static void AddKey(Filters& filters, int uid, const std::string& name);
+	void RebuildLoop();
+	bool Rebuild();
+	void OnProfileChanged(const std::string& message);
+	std::shared_ptr<Filters> _filters;
+	double _fp_rate;
+	int _rebuild_sec;
+	// 重建期间收到的增量，换上新过滤器前补进去
+	std::mutex _pending_mtx;
+	bool _b_rebuilding;
+	std::vector<std::pair<int, std::string> > _pending;
+	std::atomic<bool> _b_stop;
+	bool _b_rebuild_now;
+	std::mutex _rebuild_mtx;
+	std::condition_variable _rebuild_cond;
+	std::thread _rebuilder;
+	std::atomic<uint64_t> _rebuilds;
+	std::atomic<uint64_t> _checks;
+	std::atomic<uint64_t> _rejected;
+	std::atomic<uint64_t> _false_positives;
+};
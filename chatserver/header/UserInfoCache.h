@@ -0,0 +1,80 @@
+#pragma once
+#include "Singleton.h"
+#include "const.h"
+#include "data.h"
+#include "SingleFlight.h"
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+struct UserCacheStat {
+	uint64_t size = 0;
+	uint64_t hits = 0;
+	uint64_t negative_hits = 0;
+	uint64_t misses = 0;
+	uint64_t redis_hits = 0;
+	uint64_t db_loads = 0;
+	// 未命中时与同 uid 正在进行的加载合并、没有单独查 Redis/MySQL 的次数
+	uint64_t coalesced = 0;
+	uint64_t invalidations = 0;
+};
+
+// 进程内的用户基础信息缓存（L1），位于 Redis 的 ubaseinfo_ 之前。
+// 按 uid 分片加锁，每片按 LRU 淘汰，条目带过期时间；MySQL 中不存在的 uid 记为空条目，
+// 过期时间更短，避免不存在的 uid 反复打到 MySQL。
+// 只有未命中且 UserExistFilter 判定可能存在时才查 Redis，Redis 也未命中再查 MySQL 并写回，同一 uid 并发未命中只加载一次；写回 Redis 时在 USER_CACHE_CHANNEL
+// 上广播 uid，各 chatserver 订阅该频道删除自己的条目，订阅断线重连后整体清空。
+// 返回的 UserInfo 在各调用方之间共享，只能读，更新时整体替换条目
+class UserInfoCache :public Singleton<UserInfoCache>
+{
+	friend class Singleton<UserInfoCache>;
+public:
+	~UserInfoCache();
+	// 依次查 L1、Redis、MySQL，用户不存在时返回 false
+	bool Get(int uid, std::shared_ptr<UserInfo>& userinfo);
+	// 用已从 Redis 取到的 ubaseinfo_ 内容填充 L1，例如登录脚本顺带带回的缓存，解析失败时返回 false
+	bool Put(int uid, const std::string& info_str, std::shared_ptr<UserInfo>& userinfo);
+	void Invalidate(int uid);
+	void Clear();
+	UserCacheStat GetStats();
+	static bool ParseBaseInfo(const std::string& info_str, std::shared_ptr<UserInfo>& userinfo);
+	static std::string DumpBaseInfo(const UserInfo& userinfo);
+private:
+	UserInfoCache();
+	struct Entry {
+		// 为空表示该 uid 在 MySQL 中不存在
+		std::shared_ptr<UserInfo> info;
+		std::chrono::steady_clock::time_point expire;
+		std::list<int>::iterator lru_iter;
+	};
+	struct Shard {
+		std::mutex mtx;
+		std::unordered_map<int, Entry> entries;
+		// 表头为最近使用
+		std::list<int> lru;
+	};
+	Shard& GetShard(int uid);
+	// 命中时返回 true，userinfo 为空表示空条目
+	bool Lookup(int uid, std::shared_ptr<UserInfo>& userinfo);
+	// 查 Redis，未命中再查 MySQL 并写回，结果放入 L1；用户不存在时返回空
+	std::shared_ptr<UserInfo> Load(int uid);
+	void Insert(int uid, std::shared_ptr<UserInfo> userinfo);
+	void OnInvalidate(const std::string& message);
+	Shard _shards[USER_CACHE_SHARDS];
+	std::size_t _shard_capacity;
+	std::chrono::seconds _ttl;
+	std::chrono::seconds _negative_ttl;
+	// 广播消息为 "uid|服务器名"，收到自己发出的消息时跳过
+	std::string _self_name;
+	SingleFlight<int, std::shared_ptr<UserInfo>> _loads;
+	std::atomic<uint64_t> _hits;
+	std::atomic<uint64_t> _negative_hits;
+	std::atomic<uint64_t> _misses;
+	std::atomic<uint64_t> _redis_hits;
+	std::atomic<uint64_t> _db_loads;
+	std::atomic<uint64_t> _invalidations;
+};
@@ -13,9 +13,13 @@ public:
 	std::shared_ptr<CSession> GetSession(int uid);
 	void SetUserSession(int uid, std::shared_ptr<CSession> session);
 	void RmvUserSession(int uid, std::string session_id);
+	// 登录时的 Redis 绑定和本机映射、以及远端发来的踢人，按 uid 分段串行，保证两者指向同一会话
+	std::mutex& GetBindMutex(int uid);
 private:
 	UserMgr();
+	static const int BIND_MUTEX_COUNT = 64;
 	std::mutex _session_mtx;
+	std::mutex _bind_mtx[BIND_MUTEX_COUNT];
 	std::unordered_map<int, std::shared_ptr<CSession>> _uid_to_session;
 };
 
@@ -0,0 +1,94 @@
+#pragma once
+#include "Singleton.h"
+#include "const.h"
+#include "data.h"
+#include "MsgClass.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// 一条搜索结果，只含公开资料
+struct SearchHit {
+	int uid = 0;
+	std::string name;
+	std::string nick;
+	std::string desc;
+	std::string icon;
+	int sex = 0;
+	// 越小越靠前：uid 或名字精确匹配 < 前缀匹配 < 容错匹配，名字优先于昵称
+	int score = 0;
+};
+
+struct SearchIndexStat {
+	bool b_ready = false;
+	uint64_t users = 0;
+	uint64_t max_uid = 0;
+	LatencyStat latency;
+};
+
+// 用户名和昵称的内存搜索索引，SearchInfo 直接在 worker 线程上查询，不访问 Redis 和 MySQL。
+// 前缀匹配用按小写 key 排序的有序集合，容错匹配用字符二元组（按 UTF-8 码点，含首尾边界）
+// 倒排表选出候选，再按编辑距离校验，长度 3~5 允许 1 处错误，更长允许 2 处；
+// 候选至少共有 SEARCH_MIN_SHARED_GRAMS 个二元组，只校验共有最多的 SEARCH_MAX_FUZZY_CANDIDATES 个。
+// 启动后后台线程按 uid 分批从 MySQL 加载，加载期间查不到的请求回退到原来的精确查询；
+// 之后订阅 USER_PROFILE_CHANNEL：uid 大于已加载的最大 uid 时补齐新注册的用户，
+// 否则重新读取该用户的资料；另外每 CatchupSec 秒补齐一次，兜底订阅断线期间漏掉的注册
+class UserSearchIndex :public Singleton<UserSearchIndex>
+{
+	friend class Singleton<UserSearchIndex>;
+public:
+	~UserSearchIndex();
+	void Start();
+	void Stop();
+	void Upsert(const UserInfo& user);
+	void Remove(int uid);
+	// 纯数字的查询同时按 uid 精确匹配
+	std::vector<SearchHit> Search(const std::string& query, std::size_t top_k);
+	// 首轮加载完成前查不到不代表用户不存在
+	bool IsReady();
+	std::size_t GetTopK();
+	SearchIndexStat GetStats();
+private:
+	UserSearchIndex();
+	struct Doc {
+		std::string name;
+		std::string nick;
+		std::string desc;
+		std::string icon;
+		int sex = 0;
+		// 转成小写后的名字和昵称，用于前缀集合和二元组
+		std::string name_key;
+		std::string nick_key;
+		// name_key、nick_key 解码后的码点，计算编辑距离时不必每次重新解码
+		std::u32string name_cps;
+		std::u32string nick_cps;
+	};
+	void UpsertLocked(const UserInfo& user);
+	void RemoveLocked(int uid);
+	void IndexDoc(int uid, const Doc& doc, bool b_add);
+	void LoadLoop();
+	void OnProfileChanged(const std::string& message);
+	void WakeLoader();
+	std::shared_mutex _mtx;
+	std::unordered_map<int, Doc> _docs;
+	std::set<std::pair<std::string, int>> _prefix;
+	std::unordered_map<uint64_t, std::vector<int>> _grams;
+	std::size_t _top_k;
+	int _load_batch;
+	int _catchup_sec;
+	std::atomic<int> _max_uid;
+	std::atomic<bool> _b_ready;
+	std::atomic<bool> _b_stop;
+	bool _b_catchup;
+	std::mutex _load_mtx;
+	std::condition_variable _load_cond;
+	std::thread _loader;
+	LatencyRecorder _latency;
+};
@@ -17,6 +17,7 @@ enum ErrorCodes {
 	PasswdInvalid = 1009,
 	TokenInvalid = 1010,
 	UidInvalid = 1011,
+	ServerBusy = 1012,
 };
 
 
@@ -36,10 +37,94 @@ private:
 #define HEAD_TOTAL_LEN 4
 #define HEAD_ID_LEN 2
 #define HEAD_DATA_LEN 2
+//MsgNode 的长度是 short，整帧（含包头）不能超过 32767，Send 拒绝更长的消息体
+#define MAX_SEND_BODY (32767 - HEAD_TOTAL_LEN)
+//交给处理函数的消息体字符串尾部预留的字节数，不小于 simdjson 的 SIMDJSON_PADDING，可原地解析
+#define JSON_PADDING 64
+//接收环形缓冲区大小，必须是 2 的幂且能放下一个完整帧
+#define RECV_BUF_SIZE 1024*8
+//每个逻辑 worker 队列的容量上限，可在 config.ini 的 [LogicSystem] QueueCapacity 中覆盖
 #define MAX_RECVQUE  10000
-#define MAX_SENDQUE 1000
+//处理函数异步阶段使用的 I/O 线程数默认值，可在 config.ini 的 [LogicSystem] IoThreads 中覆盖
+#define LOGIC_IO_THREAD_COUNT 8
+//逻辑 worker 每次从队列中批量取出的最大消息数
+#define LOGIC_BATCH_SIZE 64
+//控制类与批量类消息每轮的调度权重，可在 config.ini 的 [Priority] ControlWeight/BulkWeight 中覆盖
+#define MSG_CLASS_CONTROL_WEIGHT 8
+#define MSG_CLASS_BULK_WEIGHT 1
+//逻辑线程数默认值，可在 config.ini 的 [LogicSystem] Workers 中覆盖
+#define LOGIC_WORKER_COUNT 4
+//Redis 连接池大小可在 config.ini 的 [Redis] PoolSize 中指定，未指定时取 I/O 线程数 + worker 数 + 该值，
+//多出的连接留给落库、搜索索引、存在性过滤器等后台线程
+#define REDIS_POOL_EXTRA 4
+//发送队列字节水位：超过高水位进入拥塞，降到低水位以下解除
+#define SEND_HIGH_WATER_BYTES 1024*256
+#define SEND_LOW_WATER_BYTES 1024*64
+//应答和心跳不会被丢弃，但积压超过硬上限时直接断开连接
+#define SEND_HARD_LIMIT_BYTES 1024*1024
+#define MAX_SEND_BATCH 64
+#define MAX_SEND_BATCH_BYTES 1024*64
+#define SESSION_SHARD_COUNT 32
+//心跳超时与时间轮参数（毫秒），槽数乘以刻度需大于超时时间
+#define HEARTBEAT_TIMEOUT_MS 20000
+#define HEARTBEAT_TICK_MS 100
+#define HEARTBEAT_WHEEL_SLOTS 256
+//离线收件箱默认参数，可在 config.ini 的 [OfflineInbox] MaxSize/TTL/BatchSize 中覆盖，TTL 单位为秒
+#define OFFLINE_INBOX_MAX_SIZE 5000
+#define OFFLINE_INBOX_TTL 604800
+#define OFFLINE_BATCH_SIZE 200
+//单个离线批量帧的消息体上限，需小于 MAX_SEND_BODY；单条超过上限的离线消息不存入收件箱
+#define OFFLINE_FRAME_BYTES 1024*16
+//补发期间发送队列超过低水位时最多等待的毫秒数，仍未消化则剩余消息留到下次登录
+#define OFFLINE_DRAIN_WAIT_MS 2000
+//等待发送队列消化时的重试间隔（毫秒），由定时器触发，不占用 I/O 线程
+#define OFFLINE_DRAIN_RETRY_MS 10
+//聊天记录落库默认参数，可在 config.ini 的 [MsgPersist] BatchSize/FlushIntervalMs/MaxBacklog 中覆盖
+#define PERSIST_BATCH_SIZE 500
+#define PERSIST_FLUSH_INTERVAL_MS 50
+#define PERSIST_MAX_BACKLOG 100000
+//一次成组提交失败后的重试次数，仍失败则丢弃该批并计数
+#define PERSIST_RETRY_TIMES 3
+//准入控制默认参数，可在 config.ini 的 [Overload] 中覆盖：任一 worker 队列占用超过容量的百分比、
+//队首消息排队超过的毫秒数即进入过载；连接数超过上限时暂停 accept
+#define OVERLOAD_QUEUE_HIGH_PERCENT 50
+#define OVERLOAD_QUEUE_WAIT_MS 200
+#define OVERLOAD_MAX_CONNECTIONS 50000
+#define OVERLOAD_CHECK_MS 200
+//暂停 accept 期间重新检查的间隔，未接受的连接留在内核的监听队列中
+#define OVERLOAD_ACCEPT_RETRY_MS 100
+//进程内用户信息缓存默认参数，可在 config.ini 的 [UserCache] Capacity/TTL/NegativeTTL 中覆盖，TTL 单位为秒
+#define USER_CACHE_CAPACITY 100000
+#define USER_CACHE_TTL 300
+#define USER_CACHE_NEGATIVE_TTL 30
+#define USER_CACHE_SHARDS 16
+//好友列表缓存的过期时间（秒），AddFriend 时主动删除，过期只用来兜底好友资料的变更
+#define FRIEND_LIST_TTL 3600
+//用户搜索索引默认参数，可在 config.ini 的 [Search] TopK/LoadBatch/CatchupSec 中覆盖：
+//每次返回的最大条数、启动时每批从 MySQL 加载的用户数、补齐新注册用户的周期（秒）
+#define SEARCH_TOP_K 10
+#define SEARCH_LOAD_BATCH 2000
+#define SEARCH_CATCHUP_SEC 30
+//出现次数超过该值的 n-gram 不参与模糊匹配的候选统计，避免常见字把候选集撑大
+#define SEARCH_MAX_POSTINGS 20000
+//模糊匹配的候选至少要与查询共有的二元组个数，短查询按公式算出 1 时候选会暴涨
+#define SEARCH_MIN_SHARED_GRAMS 2
+//每次查询最多对多少个候选计算编辑距离，按共有二元组个数从多到少取
+#define SEARCH_MAX_FUZZY_CANDIDATES 256
+//用户存在性过滤器默认参数，可在 config.ini 的 [UserFilter] FalsePositiveRate/RebuildSec 中覆盖：
+//目标误判率、整体重建的周期（秒）；每批从 MySQL 读取的 uid 和用户名个数
+#define USER_FILTER_FP_RATE 0.01
+#define USER_FILTER_REBUILD_SEC 3600
+#define USER_FILTER_LOAD_BATCH 5000
 
 
+//慢消费者处理策略，可在 config.ini 的 [SendQueue] Policy 中配置 drop/coalesce/disconnect
+enum SlowConsumerPolicy {
+	SlowConsumerDrop = 0,
+	SlowConsumerCoalesce = 1,
+	SlowConsumerDisconnect = 2,
+};
+
 enum MSG_IDS {
 	MSG_CHAT_LOGIN = 1005,
 	MSG_CHAT_LOGIN_RSP = 1006,
@@ -57,6 +142,7 @@ enum MSG_IDS {
 	ID_NOTIFY_OFF_LINE_REQ = 1021,
 	ID_HEART_BEAT_REQ = 1023,
 	ID_HEARTBEAT_RSP = 1024,
+	ID_NOTIFY_OFFLINE_MSG_BATCH = 1025, //登录后批量下发离线消息，固定为 JSON
 };
 
 #define USERIPPREFIX  "uip_"
@@ -64,10 +150,21 @@ enum MSG_IDS {
 #define IPCOUNTPREFIX  "ipcount_"
 #define USER_BASE_INFO "ubaseinfo_"
 #define LOGIN_COUNT  "logincount"
+#define SERVER_LOAD  "serverload"
+//SERVER_LOAD 最近一次写入的时间（Unix 秒），StatusServer 据此跳过已经宕掉、没来得及删除记录的节点
+#define SERVER_LOAD_TIME  "serverloadtime"
 #define NAME_INFO  "nameinfo_"
 #define LOCK_PREFIX "lock_"
 #define USER_SESSION_PREFIX "usession_"
 #define LOCK_COUNT "lockcount"
+#define OFFLINE_INBOX_PREFIX "offline_"
+#define FRIEND_LIST_PREFIX "friendlist_"
+//好友列表缓存的版本号，好友关系变化时自增，写回前比对，避免把变化前读到的列表写回去
+#define FRIEND_LIST_VER_PREFIX "friendlistver_"
+//ubaseinfo_ 写回时广播 uid 的频道，各 chatserver 据此删除进程内缓存
+#define USER_CACHE_CHANNEL "ubaseinfo_invalidate"
+//用户注册或资料变更后广播 "uid|name" 的频道，由 gateserver 等写入方发布，用于更新搜索索引和存在性过滤器
+#define USER_PROFILE_CHANNEL "user_profile"
 
 #define LOCK_TIME_OUT 10
 #define ACQUIRE_TIME_OUT 5
@@ -28,3 +28,11 @@ struct ApplyInfo {
 	int _status;
 };
 
+
+// 离线收件箱中的一条消息，payload 为对应通知的 JSON 消息体
+struct OfflineMsg {
+	OfflineMsg() :id(0), msg_id(0) {}
+	long long id;
+	int msg_id;
+	std::string payload;
+};
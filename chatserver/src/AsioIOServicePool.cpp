@@ -20,11 +20,23 @@ AsioIOServicePool::~AsioIOServicePool() {
 }
 
 boost::asio::io_context& AsioIOServicePool::GetIOService() {
-	auto& service = _ioServices[_nextIOService++];
+	return _ioServices[GetNextIndex()];
+}
+
+boost::asio::io_context& AsioIOServicePool::GetIOService(std::size_t index) {
+	return _ioServices[index];
+}
+
+std::size_t AsioIOServicePool::GetNextIndex() {
+	auto index = _nextIOService++;
 	if (_nextIOService == _ioServices.size()) {
 		_nextIOService = 0;
 	}
-	return service;
+	return index;
+}
+
+std::size_t AsioIOServicePool::Size() {
+	return _ioServices.size();
 }
 
 void AsioIOServicePool::Stop(){
@@ -0,0 +1,85 @@
+#include "BloomFilter.h"
+#include <algorithm>
+#include <cmath>
+
+BloomFilter::BloomFilter(std::size_t expected, double fp_rate) :_count(0), _set_bits(0) {
+	if (expected == 0) {
+		expected = 1;
+	}
+	if (fp_rate <= 0 || fp_rate >= 1) {
+		fp_rate = 0.01;
+	}
+
+	// m = -n ln p / (ln 2)^2，k = m / n * ln 2
+	const double ln2 = std::log(2.0);
+	double bits = -static_cast<double>(expected) * std::log(fp_rate) / (ln2 * ln2);
+	_words = (std::max)(std::size_t(1), static_cast<std::size_t>(std::ceil(bits / 64)));
+	_bits = _words * 64;
+	_hashes = (std::max)(1, static_cast<int>(std::lround(static_cast<double>(_bits) / expected * ln2)));
+	_data.reset(new std::atomic<uint64_t>[_words]);
+	for (std::size_t i = 0; i < _words; ++i) {
+		_data[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+// 双重哈希：第 i 个位置为 h1 + i * h2，h2 取奇数保证遍历到不同的位
+void BloomFilter::Add(uint64_t hash) {
+	uint64_t h1 = hash;
+	uint64_t h2 = Hash(hash) | 1;
+	for (int i = 0; i < _hashes; ++i) {
+		std::size_t bit = (h1 + i * h2) % _bits;
+		uint64_t mask = uint64_t(1) << (bit & 63);
+		if ((_data[bit >> 6].fetch_or(mask, std::memory_order_relaxed) & mask) == 0) {
+			_set_bits.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+	_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool BloomFilter::MayContain(uint64_t hash) const {
+	uint64_t h1 = hash;
+	uint64_t h2 = Hash(hash) | 1;
+	for (int i = 0; i < _hashes; ++i) {
+		std::size_t bit = (h1 + i * h2) % _bits;
+		if ((_data[bit >> 6].load(std::memory_order_relaxed) & (uint64_t(1) << (bit & 63))) == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+std::size_t BloomFilter::GetCount() const {
+	return _count.load(std::memory_order_relaxed);
+}
+
+std::size_t BloomFilter::GetMemoryBytes() const {
+	return _words * sizeof(uint64_t);
+}
+
+int BloomFilter::GetHashes() const {
+	return _hashes;
+}
+
+// 一个不存在的元素的 k 个位恰好都已置位的概率
+double BloomFilter::EstimatedFpRate() const {
+	double fill = static_cast<double>(_set_bits.load(std::memory_order_relaxed)) / _bits;
+	return std::pow(fill, _hashes);
+}
+
+// splitmix64 的终结函数，连续的 uid 也能散开
+uint64_t BloomFilter::Hash(uint64_t key) {
+	key += 0x9E3779B97F4A7C15ULL;
+	key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+	return key ^ (key >> 31);
+}
+
+// FNV-1a 后再混合一次
+uint64_t BloomFilter::Hash(const std::string& key) {
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	for (unsigned char c : key) {
+		hash ^= c;
+		hash *= 0x100000001B3ULL;
+	}
+	return Hash(hash);
+}
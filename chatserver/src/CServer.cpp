@@ -1,16 +1,72 @@
 #include "CServer.h"
 #include <iostream>
+#include <ctime>
 #include "AsioIOServicePool.h"
 #include "UserMgr.h"
 #include "RedisMgr.h"
 #include "ConfigMgr.h"
+#include "MsgNodePool.h"
+#include "LogicSystem.h"
+#include "OfflineInbox.h"
+#include "MsgPersist.h"
+#include "OverloadGuard.h"
+#include "UserInfoCache.h"
+#include "UserSearchIndex.h"
+#include "UserExistFilter.h"
+
+#ifdef SO_REUSEPORT
+using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+// 打开并监听一个 acceptor，多 acceptor 模式下由内核在同端口的多个 acceptor 间分发连接
+static std::unique_ptr<tcp::acceptor> MakeAcceptor(boost::asio::io_context& io_context, short port, bool reuse_port_on) {
+	tcp::endpoint endpoint(tcp::v4(), port);
+	auto acceptor = std::make_unique<tcp::acceptor>(io_context);
+	acceptor->open(endpoint.protocol());
+	acceptor->set_option(tcp::acceptor::reuse_address(true));
+#ifdef SO_REUSEPORT
+	if (reuse_port_on) {
+		acceptor->set_option(reuse_port(true));
+	}
+#endif
+	acceptor->bind(endpoint);
+	acceptor->listen();
+	return acceptor;
+}
 
 CServer::CServer(boost::asio::io_context& io_context, short port):_io_context(io_context), _port(port),
-_acceptor(io_context, tcp::endpoint(tcp::v4(),port)), _timer(_io_context, std::chrono::seconds(60))
+_b_reuse_port(false), _timer(_io_context, std::chrono::seconds(60)), _overload_timer(_io_context)
 {
-	cout << "Server start success, listen on port : " << _port << endl;
+	auto& cfg = ConfigMgr::Inst();
+	_b_reuse_port = cfg["SelfServer"]["ReusePort"] == "true";
+#ifndef SO_REUSEPORT
+	if (_b_reuse_port) {
+		cout << "SO_REUSEPORT not supported, fall back to single acceptor" << endl;
+		_b_reuse_port = false;
+	}
+#endif
+
+	auto pool = AsioIOServicePool::GetInstance();
+	if (_b_reuse_port) {
+		for (std::size_t i = 0; i < pool->Size(); ++i) {
+			_acceptors.push_back(MakeAcceptor(pool->GetIOService(i), port, true));
+		}
+	}
+	else {
+		_acceptors.push_back(MakeAcceptor(io_context, port, false));
+	}
+	cout << "Server start success, listen on port : " << _port << ", acceptors : " << _acceptors.size() << endl;
+
+	for (std::size_t i = 0; i < pool->Size(); ++i) {
+		auto wheel = std::make_shared<HeartbeatWheel>(pool->GetIOService(i));
+		wheel->Start();
+		_wheels.push_back(wheel);
+	}
 
-	StartAccept();
+	for (std::size_t i = 0; i < _acceptors.size(); ++i) {
+		_accept_timers.push_back(std::make_unique<boost::asio::steady_timer>(_acceptors[i]->get_executor()));
+		StartAccept(i);
+	}
 }
 
 CServer::~CServer() {
@@ -18,55 +74,59 @@ CServer::~CServer() {
 	
 }
 
-void CServer::HandleAccept(shared_ptr<CSession> new_session, const boost::system::error_code& error){
+void CServer::HandleAccept(shared_ptr<CSession> new_session, std::size_t acceptor_index, std::size_t io_index,
+	const boost::system::error_code& error){
 	if (!error) {
+		// 先登记再启动读，避免第一次读回调时校验失败
+		new_session->SetValid(true);
+		_sessions.Insert(new_session->GetSessionId(), new_session);
+		new_session->UpdateHeartbeat();
+		_wheels[io_index]->Add(new_session);
 		new_session->Start();
-		lock_guard<mutex> lock(_mutex);
-		_sessions.insert(make_pair(new_session->GetSessionId(), new_session));
 	}
 	else {
 		cout << "session accept failed, error is " << error.what() << endl;
 	}
 
-	StartAccept();
+	StartAccept(acceptor_index);
 }
 
-void CServer::StartAccept() {
-	auto &io_context = AsioIOServicePool::GetInstance()->GetIOService();
-	shared_ptr<CSession> new_session = make_shared<CSession>(io_context, this);
-	_acceptor.async_accept(new_session->GetSocket(), std::bind(&CServer::HandleAccept, this, new_session, placeholders::_1));
+void CServer::StartAccept(std::size_t acceptor_index) {
+	// 过载或连接数已满时先不 accept，新连接留在内核的监听队列里，稍后再检查
+	auto guard = OverloadGuard::GetInstance();
+	if (guard->AcceptPaused()) {
+		guard->CountPausedAccept();
+		auto& timer = _accept_timers[acceptor_index];
+		timer->expires_after(std::chrono::milliseconds(guard->GetAcceptRetryMs()));
+		timer->async_wait([this, acceptor_index](boost::system::error_code ec) {
+			if (ec) {
+				return;
+			}
+			StartAccept(acceptor_index);
+		});
+		return;
+	}
+
+	auto pool = AsioIOServicePool::GetInstance();
+	// ReusePort 模式下连接留在接受它的线程上，否则轮询分配到线程池
+	auto io_index = _b_reuse_port ? acceptor_index : pool->GetNextIndex();
+	shared_ptr<CSession> new_session = make_shared<CSession>(pool->GetIOService(io_index), this);
+	_acceptors[acceptor_index]->async_accept(new_session->GetSocket(),
+		std::bind(&CServer::HandleAccept, this, new_session, acceptor_index, io_index, placeholders::_1));
 }
 
 void CServer::ClearSession(std::string session_id) {
-	
-	lock_guard<mutex> lock(_mutex);
-	if (_sessions.find(session_id) != _sessions.end()) {
-		auto uid = _sessions[session_id]->GetUserId();
-
-		UserMgr::GetInstance()->RmvUserSession(uid, session_id);
+	auto session = _sessions.Erase(session_id);
+	if (session == nullptr) {
+		return;
 	}
 
-	_sessions.erase(session_id);
-	
+	session->SetValid(false);
+	UserMgr::GetInstance()->RmvUserSession(session->GetUserId(), session_id);
 }
 
 shared_ptr<CSession> CServer::GetSession(std::string uuid) {
-	lock_guard<mutex> lock(_mutex);
-	auto it = _sessions.find(uuid);
-	if (it != _sessions.end()) {
-		return it->second;
-	}
-	return nullptr;
-}
-
-bool CServer::CheckValid(std::string uuid)
-{
-	lock_guard<mutex> lock(_mutex);
-	auto it = _sessions.find(uuid);
-	if (it != _sessions.end()) {
-		return true;
-	}
-	return false;
+	return _sessions.Find(uuid);
 }
 
 void CServer::on_timer(const boost::system::error_code& ec) {
@@ -74,33 +134,112 @@ void CServer::on_timer(const boost::system::error_code& ec) {
 		std::cout << "timer error: " << ec.message() << std::endl;
 		return;
 	}
-	std::vector<std::shared_ptr<CSession>> _expired_sessions;
-	int session_count = 0;
-	std::map<std::string, shared_ptr<CSession>> sessions_copy;
-	{
-		lock_guard<mutex> lock(_mutex);
-		sessions_copy = _sessions;
-	}
-
-	time_t now = std::time(nullptr);
-	for (auto iter = sessions_copy.begin(); iter != sessions_copy.end(); iter++) {
-		auto b_expired = iter->second->IsHeartbeatExpired(now);
-		if (b_expired) {
-			iter->second->Close();
-			_expired_sessions.push_back(iter->second);
-			continue;
-		}
-		session_count++;
+	// 心跳超时由各 io_context 的时间轮增量处理，这里只上报统计
+	auto session_count = _sessions.Size();
+	uint64_t expired_count = 0;
+	for (auto& wheel : _wheels) {
+		expired_count += wheel->GetExpiredCount();
+	}
+	std::cout << "online sessions: " << session_count << ", heartbeat expired: " << expired_count << endl;
+
+	uint64_t total_writes = 0;
+	uint64_t total_frames = 0;
+	CSession::GetWriteStats(total_writes, total_frames);
+
+	if (total_writes > 0) {
+		std::cout << "send coalescing: " << total_frames << " frames in " << total_writes
+			<< " writes, frames per write is " << static_cast<double>(total_frames) / total_writes << endl;
+	}
+
+	uint64_t queued_bytes = 0;
+	uint64_t congested_sessions = 0;
+	uint64_t dropped_frames = 0;
+	CSession::GetSendQueueStats(queued_bytes, congested_sessions, dropped_frames);
+	std::cout << "send queues: " << queued_bytes << " bytes queued, " << congested_sessions
+		<< " congested sessions, " << dropped_frames << " frames dropped or coalesced" << endl;
+
+	auto depths = LogicSystem::GetInstance()->GetQueueDepths();
+	std::cout << "logic worker queue depth:";
+	for (auto depth : depths) {
+		std::cout << " " << depth;
+	}
+	std::cout << ", rejected: " << LogicSystem::GetInstance()->GetRejectedCount() << endl;
+
+	for (int cls = 0; cls < MSG_CLASS_COUNT; ++cls) {
+		auto queued = LogicSystem::GetInstance()->TakeQueueLatency(cls);
+		auto sent = CSession::TakeSendLatency(cls);
+		std::cout << "  " << MsgClassName(cls) << " latency: logic queue avg "
+			<< queued.total_us / (std::max)(queued.count, uint64_t(1)) << "us max " << queued.max_us
+			<< "us (" << queued.count << "), send queue avg "
+			<< sent.total_us / (std::max)(sent.count, uint64_t(1)) << "us max " << sent.max_us
+			<< "us (" << sent.count << ")" << endl;
 	}
 
+	std::cout << "logic handlers waiting on io: " << LogicSystem::GetInstance()->GetInflightCount() << endl;
+	for (auto& stage : LogicSystem::GetInstance()->GetStageStats()) {
+		std::cout << "  stage " << stage.first << ": " << stage.second.count << " calls, avg "
+			<< stage.second.total_us / (std::max)(stage.second.count, uint64_t(1)) << "us, max "
+			<< stage.second.max_us << "us" << endl;
+	}
+
+	uint64_t offline_pushed = 0;
+	uint64_t offline_delivered = 0;
+	OfflineInbox::GetInstance()->GetStats(offline_pushed, offline_delivered);
+	std::cout << "offline inbox: " << offline_pushed << " pushed, " << offline_delivered << " delivered" << endl;
+
+	auto persist = MsgPersist::GetInstance()->GetStats();
+	std::cout << "msg persist: backlog " << persist.backlog << ", " << persist.rows << " rows in "
+		<< persist.flushes << " flushes, avg batch " << persist.rows / (std::max)(persist.flushes, uint64_t(1))
+		<< ", flush avg " << persist.flush_total_us / (std::max)(persist.flushes, uint64_t(1)) << "us, max "
+		<< persist.flush_max_us << "us, rejected " << persist.rejected << ", failed " << persist.failed << endl;
+
+	auto user_cache = UserInfoCache::GetInstance()->GetStats();
+	auto lookups = user_cache.hits + user_cache.negative_hits + user_cache.misses;
+	std::cout << "user cache: " << user_cache.size << " entries, hit ratio "
+		<< (user_cache.hits + user_cache.negative_hits) * 100 / (std::max)(lookups, uint64_t(1)) << "% ("
+		<< user_cache.hits << " hits, " << user_cache.negative_hits << " negative hits, " << user_cache.misses
+		<< " misses), " << user_cache.redis_hits << " from redis, " << user_cache.db_loads << " from mysql, "
+		<< user_cache.invalidations << " invalidated, " << user_cache.coalesced << " coalesced" << endl;
+
+	uint64_t name_loads = 0;
+	uint64_t name_coalesced = 0;
+	LogicSystem::GetInstance()->GetNameLoadStats(name_loads, name_coalesced);
+	std::cout << "user name lookups: " << name_loads << " mysql loads, " << name_coalesced << " coalesced" << endl;
+
+	auto search = UserSearchIndex::GetInstance()->GetStats();
+	std::cout << "user search index: " << (search.b_ready ? "ready, " : "loading, ") << search.users
+		<< " users, max uid " << search.max_uid << ", " << search.latency.count << " queries, avg "
+		<< search.latency.total_us / (std::max)(search.latency.count, uint64_t(1)) << "us, max "
+		<< search.latency.max_us << "us" << endl;
+
+	// 实际误判率 = 放行后查不到的次数 / 所有不存在的查询次数
+	auto filter = UserExistFilter::GetInstance()->GetStats();
+	std::cout << "user exist filter: " << (filter.b_ready ? "ready, " : "building, ") << filter.users
+		<< " users, max uid " << filter.max_uid << ", " << filter.memory_bytes / 1024 << " KiB, estimated fp "
+		<< filter.estimated_fp_rate * 100 << "%, observed fp "
+		<< filter.false_positives * 100.0 / (std::max)(filter.rejected + filter.false_positives, uint64_t(1))
+		<< "%, " << filter.checks << " checks, " << filter.rejected << " rejected, " << filter.false_positives
+		<< " false positives, " << filter.rebuilds << " rebuilds" << endl;
+
+	uint64_t pool_allocs = 0;
+	uint64_t pool_mallocs = 0;
+	uint64_t pool_oversize = 0;
+	MsgNodePool::Inst().GetStats(pool_allocs, pool_mallocs, pool_oversize);
+	std::cout << "msg node pool: " << pool_allocs << " allocs, " << pool_mallocs
+		<< " mallocs, " << pool_oversize << " oversize" << endl;
+
+	auto overload = OverloadGuard::GetInstance()->GetStats();
+	std::cout << "overload: " << (overload.b_overloaded ? "on" : "off") << ", accept "
+		<< (overload.b_accept_paused ? "paused" : "open") << ", entered " << overload.overload_enters
+		<< " times, " << overload.paused_accepts << " deferred accepts, shed " << overload.shed_search
+		<< " search and " << overload.shed_add_friend << " add friend requests" << endl;
+
 	auto& cfg = ConfigMgr::Inst();
 	auto self_name = cfg["SelfServer"]["Name"];
 	auto count_str = std::to_string(session_count);
 	RedisMgr::GetInstance()->HSet(LOGIN_COUNT, self_name, count_str);
-
-	for (auto &session : _expired_sessions) {
-		session->DealExceptionSession();
-	}
+	// 定期重写一次，Redis 重启或中途丢失时也能恢复
+	PublishLoad(overload.b_overloaded);
 
 	_timer.expires_after(std::chrono::seconds(60));
 	_timer.async_wait([this](boost::system::error_code ec) {
@@ -114,9 +253,44 @@ void CServer::StartTimer()
 	_timer.async_wait([self](boost::system::error_code ec) {
 		self->on_timer(ec);
 		});
+	StartOverloadTimer();
+}
+
+void CServer::StartOverloadTimer() {
+	_overload_timer.expires_after(std::chrono::milliseconds(OverloadGuard::GetInstance()->GetCheckIntervalMs()));
+	_overload_timer.async_wait([this](boost::system::error_code ec) {
+		OnOverloadTimer(ec);
+	});
+}
+
+void CServer::OnOverloadTimer(const boost::system::error_code& ec) {
+	if (ec) {
+		return;
+	}
+
+	auto guard = OverloadGuard::GetInstance();
+	if (guard->Evaluate(_sessions.Size())) {
+		PublishLoad(guard->IsOverloaded());
+	}
+	StartOverloadTimer();
+}
+
+// 告知 StatusServer 本节点是否过载，过载期间新登录分配到其他节点
+void CServer::PublishLoad(bool overloaded) {
+	auto& cfg = ConfigMgr::Inst();
+	auto self_name = cfg["SelfServer"]["Name"];
+	RedisMgr::GetInstance()->HSet(SERVER_LOAD, self_name, overloaded ? "1" : "0");
+	RedisMgr::GetInstance()->HSet(SERVER_LOAD_TIME, self_name, std::to_string(std::time(nullptr)));
 }
 
 void CServer::StopTimer()
 {
 	_timer.cancel();
+	_overload_timer.cancel();
+	for (auto& timer : _accept_timers) {
+		timer->cancel();
+	}
+	for (auto& wheel : _wheels) {
+		wheel->Stop();
+	}
 }
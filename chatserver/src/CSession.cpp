@@ -4,18 +4,115 @@
 #include <sstream>
 #include <nlohmann/json.hpp>
 #include "LogicSystem.h"
+#include "OverloadGuard.h"
 #include "RedisMgr.h"
 #include "ConfigMgr.h"
+#include "HeartbeatWheel.h"
+#include "PayloadCodec.h"
+
+std::atomic<uint64_t> CSession::_write_count(0);
+std::atomic<uint64_t> CSession::_write_frames(0);
+std::atomic<uint64_t> CSession::_total_send_bytes(0);
+std::atomic<uint64_t> CSession::_congested_sessions(0);
+std::atomic<uint64_t> CSession::_total_dropped_frames(0);
+LatencyRecorder CSession::_send_latency[MSG_CLASS_COUNT];
+
+struct SendQueueConfig {
+	std::size_t high_water = SEND_HIGH_WATER_BYTES;
+	std::size_t low_water = SEND_LOW_WATER_BYTES;
+	std::size_t hard_limit = SEND_HARD_LIMIT_BYTES;
+	SlowConsumerPolicy policy = SlowConsumerDrop;
+};
+
+// 读取 [SendQueue] 配置，缺省时使用 const.h 中的默认值
+static const SendQueueConfig& GetSendQueueConfig() {
+	static SendQueueConfig config = []() {
+		SendQueueConfig cfg;
+		auto& mgr = ConfigMgr::Inst();
+		auto high_str = mgr.GetValue("SendQueue", "HighWater");
+		auto low_str = mgr.GetValue("SendQueue", "LowWater");
+		auto hard_str = mgr.GetValue("SendQueue", "HardLimit");
+		auto policy_str = mgr.GetValue("SendQueue", "Policy");
+		if (!high_str.empty()) {
+			cfg.high_water = std::stoul(high_str);
+		}
+		if (!low_str.empty()) {
+			cfg.low_water = std::stoul(low_str);
+		}
+		if (!hard_str.empty()) {
+			cfg.hard_limit = std::stoul(hard_str);
+		}
+		if (cfg.low_water > cfg.high_water) {
+			cfg.low_water = cfg.high_water;
+		}
+		if (cfg.hard_limit < cfg.high_water) {
+			cfg.hard_limit = cfg.high_water;
+		}
+		if (policy_str == "coalesce") {
+			cfg.policy = SlowConsumerCoalesce;
+		}
+		else if (policy_str == "disconnect") {
+			cfg.policy = SlowConsumerDisconnect;
+		}
+		return cfg;
+	}();
+	return config;
+}
+
+std::size_t CSession::GetSendLowWater() {
+	return GetSendQueueConfig().low_water;
+}
+
+// 拥塞时只有状态类通知可以丢弃或合并：好友申请和好友认证已写入 MySQL，重新登录时会随登录应答下发。
+// 聊天消息每条都不同，丢了无法补回，与应答、心跳和下线通知一样必须送达，积压到硬上限时断开连接
+static bool IsDroppableMsg(short msgid) {
+	switch (msgid) {
+	case ID_NOTIFY_ADD_FRIEND_REQ:
+	case ID_NOTIFY_AUTH_FRIEND_REQ:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static std::shared_ptr<SendNode>* MakeHeartbeatRsp(bool binary) {
+	HeartBeatRsp rsp;
+	rsp.set_error(ErrorCodes::Success);
+	std::string body = PayloadCodec::Encode(rsp, binary);
+	return new std::shared_ptr<SendNode>(std::make_shared<SendNode>(body.data(),
+		static_cast<short>(body.size()), ID_HEARTBEAT_RSP));
+}
+
+// 预先编码好的心跳应答帧，所有会话共享同一份只读数据，入队只增加引用计数。
+// 进程内常驻不析构，避免退出时向已销毁的线程缓存归还内存
+static const std::shared_ptr<SendNode>& HeartbeatRspNode(bool binary) {
+	static const std::shared_ptr<SendNode>* json_node = MakeHeartbeatRsp(false);
+	static const std::shared_ptr<SendNode>* binary_node = MakeHeartbeatRsp(true);
+	return binary ? *binary_node : *json_node;
+}
 
 CSession::CSession(boost::asio::io_context& io_context, CServer* server):
-	_socket(io_context), _server(server), _b_close(false),_b_head_parse(false), _user_uid(0){
+	_socket(io_context), _recv_head(0), _recv_tail(0), _server(server), _b_close(false), _b_dealt(false),
+	_b_sending(false), _send_bytes(0), _send_bytes_peak(0), _write_bytes(0), _b_congested(false),
+	_b_kicked(false), _dropped_frames(0)
+#ifdef CHATSERVER_COROUTINE_SESSION
+	, _write_signal(io_context, std::chrono::steady_clock::time_point::max())
+#endif
+	, _user_uid(0)
+{
 	boost::uuids::uuid  a_uuid = boost::uuids::random_generator()();
 	_session_id = boost::uuids::to_string(a_uuid);
-	_recv_head_node = make_shared<MsgNode>(HEAD_TOTAL_LEN);
-	_last_heartbeat = std::time(nullptr);
+	_route_hash = std::hash<std::string>()(_session_id);
+	_last_heartbeat = HeartbeatWheel::NowMs();
+	_b_valid = false;
+	_b_binary_payload = false;
 }
 CSession::~CSession() {
 	std::cout << "~CSession destruct" << endl;
+	_total_send_bytes -= _send_bytes;
+	if (_b_congested) {
+		_congested_sessions--;
+	}
 }
 
 tcp::socket& CSession::GetSocket() {
@@ -36,167 +133,411 @@ int CSession::GetUserId()
 	return _user_uid;
 }
 
+std::size_t CSession::GetRouteHash()
+{
+	return _route_hash;
+}
+
 void CSession::Start(){
-	AsyncReadHead(HEAD_TOTAL_LEN);
+#ifdef CHATSERVER_COROUTINE_SESSION
+	// 每个连接一个读协程、一个写协程，都跑在该 session 所属的 io_context 上
+	auto self = SharedSelf();
+	boost::asio::co_spawn(_socket.get_executor(), ReaderLoop(self), boost::asio::detached);
+	boost::asio::co_spawn(_socket.get_executor(), WriterLoop(self), boost::asio::detached);
+#else
+	AsyncRead();
+#endif
 }
 
 void CSession::Send(std::string msg, short msgid) {
+	// MsgNode 的长度是 short，超过上限会变成负数，这里必须先做上限校验，避免截断
+	if (msg.size() > MAX_SEND_BODY) {
+		std::cout << "payload too large: " << msg.size() << " bytes, msg id is " << msgid << std::endl;
+		return;
+	}
+
+	auto node = MakePooled<SendNode>(msg.data(), static_cast<short>(msg.size()), msgid);
 	std::lock_guard<std::mutex> lock(_send_lock);
-	int send_que_size = _send_que.size();
-	if (send_que_size > MAX_SENDQUE) {
-		std::cout << "session: " << _session_id << " send que fulled, size is " << MAX_SENDQUE << endl;
+	EnqueueSend(node);
+}
+
+void CSession::Send(char* msg, short max_length, short msgid) {
+	if (max_length < 0 || max_length > MAX_SEND_BODY) {
+		std::cout << "payload too large: " << max_length << " bytes, msg id is " << msgid << std::endl;
 		return;
 	}
+	auto node = MakePooled<SendNode>(msg, max_length, msgid);
+	std::lock_guard<std::mutex> lock(_send_lock);
+	EnqueueSend(node);
+}
 
-	// 协议若用 16 位长度，这里必须先做上限校验，避免截断
-    if (msg.size() > std::numeric_limits<uint16_t>::max()) {
-        // TODO: 记录日志 / 拆包 / 直接丢弃，按你的协议处理
-        std::cout << "payload too large: " << msg.size() << " bytes\n";
-        return;
-    }
+// 按字节水位入队，调用方需持有 _send_lock
+void CSession::EnqueueSend(std::shared_ptr<SendNode> node) {
+	if (_b_kicked) {
+		return;
+	}
+
+	auto& cfg = GetSendQueueConfig();
+	std::size_t node_bytes = node->_total_len;
+	// 无论消息是否关键，积压到硬上限说明对端已经收不动了
+	if (_send_bytes + node_bytes > cfg.hard_limit) {
+		KickSlowConsumer("send queue hit hard limit");
+		return;
+	}
 
-	const uint16_t len16 = static_cast<uint16_t>(msg.size());
+	if (_b_congested && IsDroppableMsg(node->_msg_id)) {
+		if (cfg.policy == SlowConsumerDisconnect) {
+			KickSlowConsumer("slow consumer");
+			return;
+		}
 
-	_send_que.push(make_shared<SendNode>(msg.data(), len16, msgid));
-	if (send_que_size > 0) {
+		if (cfg.policy == SlowConsumerCoalesce && CoalesceSend(node)) {
+			return;
+		}
+
+		if (cfg.policy == SlowConsumerDrop) {
+			_dropped_frames++;
+			_total_dropped_frames++;
+			return;
+		}
+	}
+
+	_send_que[MsgClassOf(node->_msg_id)].push_back({ node, LatencyRecorder::NowUs() });
+	_send_bytes += node_bytes;
+	_total_send_bytes += node_bytes;
+	if (_send_bytes > _send_bytes_peak) {
+		_send_bytes_peak = _send_bytes;
+	}
+
+	if (!_b_congested && _send_bytes >= cfg.high_water) {
+		_b_congested = true;
+		_congested_sessions++;
+		std::cout << "session: " << _session_id << " send queue congested, queued bytes is " << _send_bytes << endl;
+	}
+
+	if (_b_sending) {
 		return;
 	}
-	auto& msgnode = _send_que.front();
-	boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
-		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+	AsyncWriteBatch();
 }
 
-void CSession::Send(char* msg, short max_length, short msgid) {
-	std::lock_guard<std::mutex> lock(_send_lock);
-	int send_que_size = _send_que.size();
-	if (send_que_size > MAX_SENDQUE) {
-		std::cout << "session: " << _session_id << " send que fulled, size is " << MAX_SENDQUE << endl;
-		return;
+// 用新通知替换队列里尚未发出的同类通知，只保留最新一条，调用方需持有 _send_lock
+bool CSession::CoalesceSend(std::shared_ptr<SendNode>& node) {
+	auto& que = _send_que[MsgClassOf(node->_msg_id)];
+	for (auto iter = que.rbegin(); iter != que.rend(); ++iter) {
+		if (iter->node->_msg_id != node->_msg_id) {
+			continue;
+		}
+
+		std::size_t old_bytes = iter->node->_total_len;
+		std::size_t new_bytes = node->_total_len;
+		_send_bytes = _send_bytes - old_bytes + new_bytes;
+		_total_send_bytes += new_bytes;
+		_total_send_bytes -= old_bytes;
+		iter->node = node;
+		_dropped_frames++;
+		_total_dropped_frames++;
+		return true;
 	}
+	return false;
+}
 
-	_send_que.push(make_shared<SendNode>(msg, max_length, msgid));
-	if (send_que_size>0) {
+// 断开慢消费者，关闭投递到 session 自己的线程执行，Redis 解绑交给 I/O 线程池，都不在 _send_lock 下
+void CSession::KickSlowConsumer(const char* reason) {
+	_b_kicked = true;
+	std::cout << "session: " << _session_id << " " << reason << ", queued bytes is " << _send_bytes << endl;
+	auto self = SharedSelf();
+	boost::asio::post(_socket.get_executor(), [self]() {
+		self->Close();
+		LogicSystem::GetInstance()->RunDetached("slow_consumer_kick", [self]() {
+			self->DealExceptionSession();
+		});
+		});
+}
+
+// 把发送队列里积压的消息取出组成一批，调用方需持有 _send_lock
+bool CSession::FillWriteBatch() {
+	// 上一批已经写完，从积压字节中扣除
+	_send_bytes -= _write_bytes;
+	_total_send_bytes -= _write_bytes;
+	_write_bytes = 0;
+	if (_b_congested && _send_bytes <= GetSendQueueConfig().low_water) {
+		_b_congested = false;
+		_congested_sessions--;
+	}
+
+	_write_nodes.clear();
+	_write_bufs.clear();
+	std::size_t batch_bytes = 0;
+	// 按权重轮流从各类别队列取帧，控制类每轮先取，批量消息再多也只占自己的份额
+	const int* weights = MsgClassWeights();
+	int64_t now_us = LatencyRecorder::NowUs();
+	bool b_full = false;
+	bool b_more = true;
+	while (b_more && !b_full) {
+		b_more = false;
+		for (int cls = 0; cls < MSG_CLASS_COUNT && !b_full; ++cls) {
+			auto& que = _send_que[cls];
+			for (int taken = 0; taken < weights[cls] && !que.empty(); ++taken) {
+				auto& msgnode = que.front().node;
+				// 单条超过字节上限时也要发出去，否则会卡死队列
+				if (_write_nodes.size() >= MAX_SEND_BATCH ||
+					(!_write_nodes.empty() && batch_bytes + msgnode->_total_len > MAX_SEND_BATCH_BYTES)) {
+					b_full = true;
+					break;
+				}
+				batch_bytes += msgnode->_total_len;
+				_write_bufs.push_back(boost::asio::buffer(msgnode->_data, msgnode->_total_len));
+				_write_nodes.push_back(msgnode);
+				_send_latency[cls].Record(now_us - que.front().enqueue_us);
+				que.pop_front();
+			}
+			if (!que.empty()) {
+				b_more = true;
+			}
+		}
+	}
+	_write_bytes = batch_bytes;
+
+	if (_write_nodes.empty()) {
+		_b_sending = false;
+		return false;
+	}
+
+	_b_sending = true;
+	_write_count++;
+	_write_frames += _write_nodes.size();
+	return true;
+}
+
+// 把一批消息合并成一次 gather write 发出，调用方需持有 _send_lock
+void CSession::AsyncWriteBatch() {
+#ifdef CHATSERVER_COROUTINE_SESSION
+	// 协程模式下由 WriterLoop 负责写，这里只唤醒它
+	_b_sending = true;
+	WakeWriter();
+#else
+	if (!FillWriteBatch()) {
 		return;
 	}
-	auto& msgnode = _send_que.front();
-	boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len), 
+	boost::asio::async_write(_socket, _write_bufs,
 		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+#endif
+}
+
+LatencyStat CSession::TakeSendLatency(int cls) {
+	return _send_latency[cls].Take();
+}
+
+void CSession::GetWriteStats(uint64_t& write_count, uint64_t& write_frames) {
+	write_count = _write_count;
+	write_frames = _write_frames;
+}
+
+std::size_t CSession::GetSendQueueBytes() {
+	std::lock_guard<std::mutex> lock(_send_lock);
+	return _send_bytes;
+}
+
+std::size_t CSession::GetSendQueuePeak() {
+	std::lock_guard<std::mutex> lock(_send_lock);
+	return _send_bytes_peak;
+}
+
+uint64_t CSession::GetDroppedFrames() {
+	std::lock_guard<std::mutex> lock(_send_lock);
+	return _dropped_frames;
+}
+
+void CSession::GetSendQueueStats(uint64_t& queued_bytes, uint64_t& congested_sessions, uint64_t& dropped_frames) {
+	queued_bytes = _total_send_bytes;
+	congested_sessions = _congested_sessions;
+	dropped_frames = _total_dropped_frames;
+}
+
+void CSession::SetValid(bool valid) {
+	_b_valid.store(valid, std::memory_order_release);
+}
+
+bool CSession::IsValid() {
+	return _b_valid.load(std::memory_order_acquire);
+}
+
+void CSession::SetBinaryPayload(bool binary) {
+	_b_binary_payload = binary;
+}
+
+bool CSession::IsBinaryPayload() {
+	return _b_binary_payload;
 }
 
 void CSession::Close() {
+	if (_b_close.exchange(true)) {
+		return;
+	}
 	std::lock_guard<std::mutex> lock(_session_mtx);
 	_socket.close();
-	_b_close = true;
+#ifdef CHATSERVER_COROUTINE_SESSION
+	WakeWriter();
+#endif
 }
 
 std::shared_ptr<CSession>CSession::SharedSelf() {
 	return shared_from_this();
 }
 
-void CSession::AsyncReadBody(int total_len)
+// 环形缓冲区：只读入当前连续的空闲区域，绕回部分留给下一次读
+boost::asio::mutable_buffer CSession::RecvWindow()
 {
-	auto self = shared_from_this();
-	asyncReadFull(total_len, [self, this, total_len](const boost::system::error_code& ec, std::size_t bytes_transfered) {
-		try {
-			if (ec) {
-				std::cout << "handle read failed, error is " << ec.what() << endl;
-				Close();
-				DealExceptionSession();
-				return;
-			}
+	std::size_t used = _recv_tail - _recv_head;
+	std::size_t free_len = RECV_BUF_SIZE - used;
+	std::size_t start = _recv_tail & (RECV_BUF_SIZE - 1);
+	std::size_t read_len = (std::min)(free_len, RECV_BUF_SIZE - start);
+	return boost::asio::buffer(_recv_buf + start, read_len);
+}
 
-			if (bytes_transfered < total_len) {
-				std::cout << "read length not match, read [" << bytes_transfered << "] , total ["
-					<< total_len<<"]" << endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
+void CSession::AsyncRead()
+{
+	_socket.async_read_some(RecvWindow(),
+		std::bind(&CSession::HandleRead, this, std::placeholders::_1, std::placeholders::_2, SharedSelf()));
+}
 
-			//�ж�������Ч
-			if (!_server->CheckValid(_session_id)) {
-				Close();
-				return;
-			}
+void CSession::HandleRead(const boost::system::error_code& ec, std::size_t bytes_transfered,
+	std::shared_ptr<CSession> shared_self)
+{
+	try {
+		if (ec) {
+			std::cout << "handle read failed, error is " << ec.what() << endl;
+			Close();
+			DealExceptionSession();
+			return;
+		}
 
-			memcpy(_recv_msg_node->_data , _data , bytes_transfered);
-			_recv_msg_node->_cur_len += bytes_transfered;
-			_recv_msg_node->_data[_recv_msg_node->_total_len] = '\0';
-			cout << "receive data is " << _recv_msg_node->_data << endl;
-			//����session����ʱ��
-			UpdateHeartbeat();
-			//�˴�����ϢͶ�ݵ��߼�������
-			LogicSystem::GetInstance()->PostMsgToQue(make_shared<LogicNode>(shared_from_this(), _recv_msg_node));
-			//��������ͷ�������¼�
-			AsyncReadHead(HEAD_TOTAL_LEN);
+		//判断连接有效
+		if (!IsValid()) {
+			Close();
+			return;
 		}
-		catch (std::exception& e) {
-			std::cout << "Exception code is " << e.what() << endl;
+
+		_recv_tail += bytes_transfered;
+		if (!ParseFrames()) {
+			Close();
+			_server->ClearSession(_session_id);
+			return;
 		}
-		});
+
+		AsyncRead();
+	}
+	catch (std::exception& e) {
+		std::cout << "Exception code is " << e.what() << endl;
+	}
 }
 
-void CSession::AsyncReadHead(int total_len)
+// 从环形缓冲区拷贝 len 字节，处理绕回
+void CSession::PeekRecvBuf(std::size_t offset, char* dst, std::size_t len)
 {
-	auto self = shared_from_this();
-	asyncReadFull(HEAD_TOTAL_LEN, [self, this](const boost::system::error_code& ec, std::size_t bytes_transfered) {
-		try {
-			if (ec) {
-				std::cout << "handle read failed, error is " << ec.what() << endl;
-				Close();
-				DealExceptionSession();
-				return;
-			}
+	std::size_t start = (_recv_head + offset) & (RECV_BUF_SIZE - 1);
+	std::size_t first = (std::min)(len, RECV_BUF_SIZE - start);
+	memcpy(dst, _recv_buf + start, first);
+	if (first < len) {
+		memcpy(dst + first, _recv_buf, len - first);
+	}
+}
 
-			if (bytes_transfered < HEAD_TOTAL_LEN) {
-				std::cout << "read length not match, read [" << bytes_transfered << "] , total ["
-					<< HEAD_TOTAL_LEN << "]" << endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
+// 解出缓冲区内所有完整的 [msg_id|len|body] 帧，协议非法时返回 false
+bool CSession::ParseFrames()
+{
+	while (_recv_tail - _recv_head >= HEAD_TOTAL_LEN) {
+		char head[HEAD_TOTAL_LEN];
+		PeekRecvBuf(0, head, HEAD_TOTAL_LEN);
+
+		//获取头部MSGID数据
+		short msg_id = 0;
+		memcpy(&msg_id, head, HEAD_ID_LEN);
+		//网络字节序转化为本地字节序
+		msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+		//id非法
+		if (msg_id > MAX_LENGTH) {
+			std::cout << "invalid msg_id is " << msg_id << endl;
+			return false;
+		}
 
-			//�ж�������Ч
-			if (!_server->CheckValid(_session_id)) {
-				Close();
-				return;
-			}
+		unsigned short msg_len = 0;
+		memcpy(&msg_len, head + HEAD_ID_LEN, HEAD_DATA_LEN);
+		//网络字节序转化为本地字节序
+		msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
+		//长度非法
+		if (msg_len > MAX_LENGTH) {
+			std::cout << "invalid data length is " << msg_len << endl;
+			return false;
+		}
 
-			_recv_head_node->Clear();
-			memcpy(_recv_head_node->_data, _data, bytes_transfered);
-
-			//��ȡͷ��MSGID����
-			short msg_id = 0;
-			memcpy(&msg_id, _recv_head_node->_data, HEAD_ID_LEN);
-			//�����ֽ���ת��Ϊ�����ֽ���
-			msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
-			std::cout << "msg_id is " << msg_id << endl;
-			//id�Ƿ�
-			if (msg_id > MAX_LENGTH) {
-				std::cout << "invalid msg_id is " << msg_id << endl;
-				_server->ClearSession(_session_id);
-				return;
-			}
-			short msg_len = 0;
-			memcpy(&msg_len, _recv_head_node->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-			//�����ֽ���ת��Ϊ�����ֽ���
-			msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
-			std::cout << "msg_len is " << msg_len << endl;
-
-			//id�Ƿ�
-			if (msg_len > MAX_LENGTH) {
-				std::cout << "invalid data length is " << msg_len << endl;
-				_server->ClearSession(_session_id);
-				return;
-			}
+		// 消息体还没收全，等下一次读
+		if (_recv_tail - _recv_head < HEAD_TOTAL_LEN + msg_len) {
+			break;
+		}
+
+		//任何完整的帧都算一次心跳
+		UpdateHeartbeat();
 
-			_recv_msg_node = make_shared<RecvNode>(msg_len, msg_id);
-			AsyncReadBody(msg_len);
+		// 心跳在 IO 线程直接应答，不解析消息体、不分配节点，也不经过 LogicSystem
+		if (msg_id == ID_HEART_BEAT_REQ) {
+			_recv_head += HEAD_TOTAL_LEN + msg_len;
+			std::lock_guard<std::mutex> lock(_send_lock);
+			EnqueueSend(HeartbeatRspNode(IsBinaryPayload()));
+			continue;
 		}
-		catch (std::exception& e) {
-			std::cout << "Exception code is " << e.what() << endl;
+
+		// 没有处理函数的消息在 IO 线程直接丢弃，不进逻辑队列
+		if (!LogicSystem::IsKnownMsg(msg_id)) {
+			std::cout << "session: " << _session_id << " unknown msg_id is " << msg_id << endl;
+			_recv_head += HEAD_TOTAL_LEN + msg_len;
+			continue;
 		}
-		});
+
+		// 过载时代价高的请求不进逻辑队列，直接告知客户端繁忙
+		if (!OverloadGuard::GetInstance()->Admit(msg_id)) {
+			_recv_head += HEAD_TOTAL_LEN + msg_len;
+			ReplyBusy(msg_id);
+			continue;
+		}
+
+		auto recv_node = MakePooled<RecvNode>(msg_len, msg_id);
+		PeekRecvBuf(HEAD_TOTAL_LEN, recv_node->_data, msg_len);
+		recv_node->_cur_len = msg_len;
+		_recv_head += HEAD_TOTAL_LEN + msg_len;
+
+		//此处将消息投递到逻辑队列中，队列已满时告知客户端服务端繁忙
+		if (!LogicSystem::GetInstance()->PostMsgToQue(MakePooled<LogicNode>(shared_from_this(), recv_node))) {
+			ReplyBusy(msg_id);
+		}
+	}
+
+	// 缓冲区读空时归零，下次读可以拿到整块连续空间
+	if (_recv_head == _recv_tail) {
+		_recv_head = 0;
+		_recv_tail = 0;
+	}
+	return true;
+}
+
+// 逻辑队列已满或准入控制拒绝时对请求直接回 ServerBusy，通知类和未知消息不回复
+void CSession::ReplyBusy(short msg_id)
+{
+	short rsp_id = 0;
+	switch (msg_id) {
+	case MSG_CHAT_LOGIN:
+	case ID_SEARCH_USER_REQ:
+	case ID_ADD_FRIEND_REQ:
+	case ID_AUTH_FRIEND_REQ:
+	case ID_TEXT_CHAT_MSG_REQ:
+		// 请求和应答的 id 相邻
+		rsp_id = msg_id + 1;
+		break;
+	default:
+		return;
+	}
+	Send(PayloadCodec::EncodeError(ErrorCodes::ServerBusy, IsBinaryPayload()), rsp_id);
 }
 
 void CSession::HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self) {
@@ -205,13 +546,8 @@ void CSession::HandleWrite(const boost::system::error_code& error, std::shared_p
 		auto self = shared_from_this();
 		if (!error) {
 			std::lock_guard<std::mutex> lock(_send_lock);
-			//cout << "send data " << _send_que.front()->_data+HEAD_LENGTH << endl;
-			_send_que.pop();
-			if (!_send_que.empty()) {
-				auto& msgnode = _send_que.front();
-				boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
-					std::bind(&CSession::HandleWrite, this, std::placeholders::_1, shared_self));
-			}
+			// 上一批已写完，把写期间新入队的消息作为下一批发出
+			AsyncWriteBatch();
 		}
 		else {
 			std::cout << "handle write failed, error is " << error.what() << endl;
@@ -225,102 +561,115 @@ void CSession::HandleWrite(const boost::system::error_code& error, std::shared_p
 	
 }
 
-//��ȡ��������
-void CSession::asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code&, std::size_t)> handler )
-{
-	::memset(_data, 0, MAX_LENGTH);
-	asyncReadLen(0, maxLength, handler);
+void CSession::NotifyOffline(int uid) {
+
+	KickUserRsp rtvalue;
+	rtvalue.set_error(ErrorCodes::Success);
+	rtvalue.set_uid(uid);
+
+	Send(PayloadCodec::Encode(rtvalue, IsBinaryPayload()), ID_NOTIFY_OFF_LINE_REQ);
+	return;
 }
 
-//��ȡָ���ֽ���
-void CSession::asyncReadLen(std::size_t read_len, std::size_t total_len, 
-	std::function<void(const boost::system::error_code&, std::size_t)> handler)
+#ifdef CHATSERVER_COROUTINE_SESSION
+boost::asio::awaitable<void> CSession::ReaderLoop(std::shared_ptr<CSession> self)
 {
-	auto self = shared_from_this();
-	_socket.async_read_some(boost::asio::buffer(_data + read_len, total_len-read_len),
-		[read_len, total_len, handler, self](const boost::system::error_code& ec, std::size_t  bytesTransfered) {
-			if (ec) {
-				// ���ִ��󣬵��ûص�����
-				handler(ec, read_len + bytesTransfered);
-				return;
-			}
+	try {
+		for (;;) {
+			std::size_t bytes_transfered = co_await _socket.async_read_some(RecvWindow(),
+				boost::asio::use_awaitable);
 
-			if (read_len + bytesTransfered >= total_len) {
-				//���ȹ��˾͵��ûص�����
-				handler(ec, read_len + bytesTransfered);
-				return;
+			//判断连接有效
+			if (!IsValid()) {
+				Close();
+				co_return;
 			}
 
-			// û�д����ҳ��Ȳ����������ȡ
-			self->asyncReadLen(read_len + bytesTransfered, total_len, handler);
-	});
+			_recv_tail += bytes_transfered;
+			if (!ParseFrames()) {
+				Close();
+				_server->ClearSession(_session_id);
+				co_return;
+			}
+		}
+	}
+	catch (std::exception& e) {
+		std::cout << "handle read failed, error is " << e.what() << endl;
+		Close();
+		DealExceptionSession();
+	}
 }
 
-void CSession::NotifyOffline(int uid) {
-
-	json rtvalue = {
-        {"error",   ErrorCodes::Success},
-        {"uid", uid}
-    };
+boost::asio::awaitable<void> CSession::WriterLoop(std::shared_ptr<CSession> self)
+{
+	try {
+		while (!_b_close) {
+			bool has_batch = false;
+			{
+				std::lock_guard<std::mutex> lock(_send_lock);
+				has_batch = FillWriteBatch();
+			}
 
+			if (!has_batch) {
+				// 队列空了就挂起，Send 或 Close 会通过取消定时器唤醒
+				boost::system::error_code ec;
+				co_await _write_signal.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+				continue;
+			}
 
-	 // 紧凑序列化。若调试期想可读，用 rtvalue.dump(2)
-    std::string return_str = rtvalue.dump();
+			co_await boost::asio::async_write(_socket, _write_bufs, boost::asio::use_awaitable);
+		}
+	}
+	catch (std::exception& e) {
+		std::cout << "handle write failed, error is " << e.what() << endl;
+		Close();
+		DealExceptionSession();
+	}
+}
 
-	Send(return_str, ID_NOTIFY_OFF_LINE_REQ);
-	return;
+// 定时器操作只能在 session 自己的线程上做，跨线程时投递过去
+void CSession::WakeWriter()
+{
+	auto self = SharedSelf();
+	boost::asio::post(_socket.get_executor(), [self]() {
+		self->_write_signal.cancel();
+		});
 }
+#endif
 
 LogicNode::LogicNode(shared_ptr<CSession>  session, 
-	shared_ptr<RecvNode> recvnode):_session(session),_recvnode(recvnode) {
+	shared_ptr<RecvNode> recvnode):_session(session),_recvnode(recvnode),
+	_class(MsgClassOf(recvnode->_msg_id)), _enqueue_us(0) {
 	
 }
 
+LogicNode::LogicNode(shared_ptr<CSession> session, MsgClass cls,
+	std::function<void()> task) :_session(session), _task(std::move(task)), _class(cls), _enqueue_us(0) {
 
-bool CSession::IsHeartbeatExpired(std::time_t& now) {
-	double diff_sec = std::difftime(now, _last_heartbeat);
-	if (diff_sec > 20) {
-		std::cout << "heartbeat expired, session id is  " << _session_id << endl;
-		return true;
-	}
+}
 
-	return false;
+
+int64_t CSession::GetLastHeartbeat() {
+	return _last_heartbeat;
 }
 
+// 只记录时间戳，超时判断由所属 io_context 的 HeartbeatWheel 完成
 void CSession::UpdateHeartbeat()
 {
-	time_t now = std::time(nullptr);
-	_last_heartbeat = now;
+	_last_heartbeat.store(HeartbeatWheel::NowMs(), std::memory_order_relaxed);
 }
 
 void CSession::DealExceptionSession()
 {
+	if (_b_dealt.exchange(true)) {
+		return;
+	}
 	auto self = shared_from_this();
-	//�������session
-	auto uid_str = std::to_string(_user_uid);
-	auto lock_key = LOCK_PREFIX + uid_str;
-	auto identifier = RedisMgr::GetInstance()->acquireLock(lock_key, LOCK_TIME_OUT, ACQUIRE_TIME_OUT);
-	Defer defer([identifier, lock_key, self, this]() {
+	Defer defer([self, this]() {
 		_server->ClearSession(_session_id);
-		RedisMgr::GetInstance()->releaseLock(lock_key, identifier);
 		});
 
-	if (identifier.empty()) {
-		return;
-	}
-	std::string redis_session_id = "";
-	auto bsuccess = RedisMgr::GetInstance()->Get(USER_SESSION_PREFIX + uid_str, redis_session_id);
-	if (!bsuccess) {
-		return;
-	}
-
-	if (redis_session_id != _session_id) {
-		//˵���пͻ���������������ص�¼��
-		return;
-	}
-
-	RedisMgr::GetInstance()->Del(USER_SESSION_PREFIX + uid_str);
-	//����û���¼��Ϣ
-	RedisMgr::GetInstance()->Del(USERIPPREFIX + uid_str);
+	// 比较会话 id 和删除绑定在同一个 Redis 脚本里完成，新登录已覆盖绑定时不会误删，不再需要分布式锁
+	RedisMgr::GetInstance()->UnbindSession(_user_uid, _session_id);
 }
 
@@ -3,6 +3,7 @@
 
 #include "LogicSystem.h"
 #include <csignal>
+#include <ctime>
 #include <thread>
 #include <mutex>
 #include "AsioIOServicePool.h"
@@ -10,6 +11,9 @@
 #include "ConfigMgr.h"
 #include "RedisMgr.h"
 #include "ChatServiceImpl.h"
+#include "MsgPersist.h"
+#include "UserSearchIndex.h"
+#include "UserExistFilter.h"
 #include "const.h"
 
 using namespace std;
@@ -27,11 +31,21 @@ int main()
 		auto pool = AsioIOServicePool::GetInstance();
 		//将登录数设置为0
 		RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, "0");
+		RedisMgr::GetInstance()->HSet(SERVER_LOAD, server_name, "0");
+		//启动时就登记，StatusServer 不必等第一次定时刷新才分配登录
+		RedisMgr::GetInstance()->HSet(SERVER_LOAD_TIME, server_name, std::to_string(std::time(nullptr)));
 		Defer derfer ([server_name]() {
 				RedisMgr::GetInstance()->HDel(LOGIN_COUNT, server_name);
+				RedisMgr::GetInstance()->HDel(SERVER_LOAD, server_name);
+				RedisMgr::GetInstance()->HDel(SERVER_LOAD_TIME, server_name);
 				RedisMgr::GetInstance()->Close();
 			});
 
+		//后台加载用户搜索索引，加载完成前按名字的搜索回退到精确查询
+		UserSearchIndex::GetInstance()->Start();
+		//后台构建用户存在性过滤器，构建完成前所有查询照常回源
+		UserExistFilter::GetInstance()->Start();
+
 		boost::asio::io_context  io_context;
 		auto port_str = cfg["SelfServer"]["Port"];
 		//创建Cserver智能指针
@@ -72,6 +86,10 @@ int main()
 
 		grpc_server_thread.join();
 		pointer_server->StopTimer();
+		UserSearchIndex::GetInstance()->Stop();
+		UserExistFilter::GetInstance()->Stop();
+		// 写完缓冲区中的聊天记录再退出
+		MsgPersist::GetInstance()->Close();
 		return 0;
 	}
 	catch (std::exception& e) {
@@ -4,6 +4,10 @@
 #include <nlohmann/json.hpp>
 #include "RedisMgr.h"
 #include "MysqlMgr.h"
+#include "PayloadCodec.h"
+#include "OfflineInbox.h"
+#include "MsgPersist.h"
+#include "UserInfoCache.h"
 
 ChatServiceImpl::ChatServiceImpl()
 {
@@ -22,25 +26,23 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
 		reply->set_touid(request->touid());
 		});
 
-	// 用户不在本服务器，直接返回
+	AddFriendNotify notify;
+	notify.set_error(ErrorCodes::Success);
+	notify.set_applyuid(request->applyuid());
+	notify.set_name(request->name());
+	notify.set_desc(request->desc());
+	notify.set_icon(request->icon());
+	notify.set_sex(request->sex());
+	notify.set_nick(request->nick());
+
+	// 用户已不在本服务器，存入离线收件箱，登录时补发
 	if (session == nullptr) {
+		OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_ADD_FRIEND_REQ, PayloadCodec::Encode(notify, false));
 		return Status::OK;
 	}
 	
-	// 在本服务器，直接下发通知
-	json rtvalue = {
-        {"error",    ErrorCodes::Success},
-        {"applyuid", request->applyuid()},
-        {"name",     request->name()},
-        {"desc",     request->desc()},
-        {"icon",     request->icon()},
-        {"sex",      request->sex()},
-        {"nick",     request->nick()},
-    };
-
-
-	std::string return_str = rtvalue.dump();
-    session->Send(return_str, ID_NOTIFY_ADD_FRIEND_REQ);
+	// 在本服务器，按对端会话的负载格式下发通知
+    session->Send(PayloadCodec::Encode(notify, session->IsBinaryPayload()), ID_NOTIFY_ADD_FRIEND_REQ);
     return Status::OK;
 }
 
@@ -58,33 +60,31 @@ Status ChatServiceImpl::NotifyAuthFriend(ServerContext* context,
 		reply->set_touid(request->touid());
 		});
 
-	// 用户不在本服务器，直接返回
-	if (session == nullptr) {
-		return Status::OK;
-	}
-
-	// 在本服务器，直接下发通知
-    json rtvalue = {
-        {"error",  ErrorCodes::Success},
-        {"fromuid", request->fromuid()},
-        {"touid",   request->touid()},
-    };
+	AuthFriendNotify notify;
+	notify.set_error(ErrorCodes::Success);
+	notify.set_fromuid(request->fromuid());
+	notify.set_touid(request->touid());
 
-	std::string base_key = USER_BASE_INFO + std::to_string(fromuid);
-	auto user_info = std::make_shared<UserInfo>();
-	bool b_info = GetBaseInfo(base_key, fromuid, user_info);
+	std::shared_ptr<UserInfo> user_info;
+	bool b_info = UserInfoCache::GetInstance()->Get(fromuid, user_info);
 	if (b_info) {
-		rtvalue["name"] = user_info->name;
-		rtvalue["nick"] = user_info->nick;
-		rtvalue["icon"] = user_info->icon;
-		rtvalue["sex"] = user_info->sex;
+		notify.set_name(user_info->name);
+		notify.set_nick(user_info->nick);
+		notify.set_icon(user_info->icon);
+		notify.set_sex(user_info->sex);
 	}
 	else {
-		rtvalue["error"] = ErrorCodes::UidInvalid;
+		notify.set_error(ErrorCodes::UidInvalid);
+	}
+
+	// 用户已不在本服务器，存入离线收件箱，登录时补发
+	if (session == nullptr) {
+		OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_AUTH_FRIEND_REQ, PayloadCodec::Encode(notify, false));
+		return Status::OK;
 	}
 
-	std::string return_str = rtvalue.dump();
-    session->Send(return_str, ID_NOTIFY_AUTH_FRIEND_REQ);
+	// 在本服务器，按对端会话的负载格式下发通知
+    session->Send(PayloadCodec::Encode(notify, session->IsBinaryPayload()), ID_NOTIFY_AUTH_FRIEND_REQ);
     return Status::OK;
 }
 
@@ -97,97 +97,47 @@ Status ChatServiceImpl::NotifyTextChatMsg(::grpc::ServerContext* context,
 	auto session = UserMgr::GetInstance()->GetSession(touid);
 	reply->set_error(ErrorCodes::Success);
 
-	// 用户不在本服务器，直接返回
-	if (session == nullptr) {
+	// 跨机消息在接收方落库，积压时回 ServerBusy，由发送方服务器转告客户端
+	std::vector<ChatRecord> records;
+	auto now_ms = MsgPersist::NowMs();
+	for (const auto& text : request->textmsgs()) {
+		ChatRecord record;
+		record.fromuid = request->fromuid();
+		record.touid = touid;
+		record.msgid = text.msgid();
+		record.content = text.msgcontent();
+		record.send_time = now_ms;
+		records.push_back(std::move(record));
+	}
+	if (!MsgPersist::GetInstance()->Enqueue(std::move(records))) {
+		reply->set_error(ErrorCodes::ServerBusy);
 		return Status::OK;
 	}
 
-	// 在本服务器，组织 JSON 下发
-    json rtvalue = {
-        {"error",   ErrorCodes::Success},
-        {"fromuid", request->fromuid()},
-        {"touid",   request->touid()},
-    };
-
-    // 把多条文本消息组织为数组
-    json text_array = json::array();
-    for (const auto& msg : request->textmsgs()) {
-        text_array.push_back({
-            {"content", msg.msgcontent()},
-            {"msgid",   msg.msgid()}
-        });
-    }
-    rtvalue["text_array"] = std::move(text_array);
+    TextChatMsgRsp notify;
+    notify.set_error(ErrorCodes::Success);
+    notify.set_fromuid(request->fromuid());
+    notify.set_touid(request->touid());
+    *notify.mutable_textmsgs() = request->textmsgs();
 
-	std::string return_str = rtvalue.dump();
-    session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
-    return Status::OK;
-}
-
-
-bool ChatServiceImpl::GetBaseInfo(std::string base_key,
-                                  int uid,
-                                  std::shared_ptr<UserInfo>& userinfo)
-{
-    // 先查 redis
-    std::string info_str;
-    bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-    if (b_base) {
-        // 非抛异常解析；失败则回源 DB
-        json root = json::parse(info_str, /*callback=*/nullptr, /*allow_exceptions=*/false);
-        if (!root.is_discarded() && root.is_object()) {
-            if (!userinfo) {
-                userinfo = std::make_shared<UserInfo>();
-            }
-            userinfo->uid   = root.value("uid",   0);
-            userinfo->name  = root.value("name",  std::string{});
-            userinfo->pwd   = root.value("pwd",   std::string{});
-            userinfo->email = root.value("email", std::string{});
-            userinfo->nick  = root.value("nick",  std::string{});
-            userinfo->desc  = root.value("desc",  std::string{});
-            userinfo->sex   = root.value("sex",   0);
-            userinfo->icon  = root.value("icon",  std::string{});
-
-            std::cout << "user login uid is " << userinfo->uid
-                      << " name is " << userinfo->name
-                      << " pwd is "   << userinfo->pwd
-                      << " email is " << userinfo->email
-                      << std::endl;
-
-            return true;
-        }
-        // 解析失败，继续回源
-    }
+	// 用户已不在本服务器，存入离线收件箱，登录时补发
+	if (session == nullptr) {
+		OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_TEXT_CHAT_MSG_REQ, PayloadCodec::Encode(notify, false));
+		return Status::OK;
+	}
 
-    // redis 未命中或解析失败：查 mysql
-    std::shared_ptr<UserInfo> user_info = MysqlMgr::GetInstance()->GetUser(uid);
-    if (!user_info) {
-        return false;
-    }
-    userinfo = user_info;
-
-    // 写回 redis
-    json redis_root = {
-        {"uid",   uid},
-        {"pwd",   userinfo->pwd},
-        {"name",  userinfo->name},
-        {"email", userinfo->email},
-        {"nick",  userinfo->nick},
-        {"desc",  userinfo->desc},
-        {"sex",   userinfo->sex},
-        {"icon",  userinfo->icon}
-    };
-    RedisMgr::GetInstance()->Set(base_key, redis_root.dump());
-
-    return true;
+	// 在本服务器，按对端会话的负载格式下发通知
+    session->Send(PayloadCodec::Encode(notify, session->IsBinaryPayload()), ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+    return Status::OK;
 }
 
 Status ChatServiceImpl::NotifyKickUser(::grpc::ServerContext* context,
                                        const KickUserReq* request,
                                        KickUserRsp* reply)
 {
-    // 判断用户是否在本服务器
+    // 判断用户是否在本服务器。与本机登录的绑定互斥，Redis 已指向本机新会话但映射还没更新时等它完成
     auto uid = request->uid();
+    std::lock_guard<std::mutex> lock(UserMgr::GetInstance()->GetBindMutex(uid));
     auto session = UserMgr::GetInstance()->GetSession(uid);
 
     Defer defer([request, reply]() {
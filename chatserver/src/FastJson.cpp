@@ -0,0 +1,164 @@
+#include "FastJson.h"
+#include "const.h"
+#include <simdjson.h>
+
+using namespace simdjson;
+
+static_assert(JSON_PADDING >= SIMDJSON_PADDING, "JSON_PADDING must cover SIMDJSON_PADDING");
+
+// 每个线程一个解析器，复用其内部缓冲区
+static thread_local ondemand::parser t_parser;
+static thread_local padded_string t_padded;
+
+static bool Iterate(const std::string& data, ondemand::document& doc) {
+	if (data.capacity() >= data.size() + SIMDJSON_PADDING) {
+		return t_parser.iterate(padded_string_view(data.data(), data.size(), data.capacity())).get(doc) == SUCCESS;
+	}
+	t_padded = padded_string(data);
+	return t_parser.iterate(t_padded).get(doc) == SUCCESS;
+}
+
+static bool GetInt(simdjson_result<ondemand::value> value, int& out) {
+	int64_t number = 0;
+	if (value.get_int64().get(number) != SUCCESS) {
+		return false;
+	}
+	out = static_cast<int>(number);
+	return true;
+}
+
+bool FastJson::ParseLogin(const std::string& data, int& uid, std::string& token) {
+	ondemand::document doc;
+	ondemand::object root;
+	if (!Iterate(data, doc) || doc.get_object().get(root) != SUCCESS) {
+		return false;
+	}
+
+	uid = 0;
+	token.clear();
+	for (auto field : root) {
+		std::string_view key;
+		if (field.unescaped_key().get(key) != SUCCESS) {
+			return false;
+		}
+		if (key == "uid") {
+			if (!GetInt(field.value(), uid)) {
+				return false;
+			}
+		}
+		else if (key == "token") {
+			std::string_view value;
+			if (field.value().get_string().get(value) != SUCCESS) {
+				return false;
+			}
+			token.assign(value.data(), value.size());
+		}
+	}
+	return true;
+}
+
+bool FastJson::ParseHeartBeat(const std::string& data, int& fromuid) {
+	ondemand::document doc;
+	ondemand::object root;
+	if (!Iterate(data, doc) || doc.get_object().get(root) != SUCCESS) {
+		return false;
+	}
+
+	fromuid = 0;
+	for (auto field : root) {
+		std::string_view key;
+		if (field.unescaped_key().get(key) != SUCCESS) {
+			return false;
+		}
+		if (key == "fromuid" && !GetInt(field.value(), fromuid)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// 记录已出现的字段，同一字段出现两次时返回 false
+static bool MarkSeen(unsigned& seen, unsigned bit) {
+	if (seen & bit) {
+		return false;
+	}
+	seen |= bit;
+	return true;
+}
+
+// 元素必须是只含 msgid、content 两个字符串字段的对象
+static bool ParseTextArray(simdjson_result<ondemand::value> value, std::vector<TextChatView::Text>& texts) {
+	ondemand::array arr;
+	if (value.get_array().get(arr) != SUCCESS) {
+		return false;
+	}
+
+	for (auto item : arr) {
+		ondemand::object obj;
+		if (item.get_object().get(obj) != SUCCESS) {
+			return false;
+		}
+		TextChatView::Text text;
+		unsigned seen = 0;
+		for (auto field : obj) {
+			std::string_view key;
+			if (field.unescaped_key().get(key) != SUCCESS) {
+				return false;
+			}
+			if (key == "msgid") {
+				if (!MarkSeen(seen, 1) || field.value().get_string().get(text.msgid) != SUCCESS) {
+					return false;
+				}
+			}
+			else if (key == "content") {
+				if (!MarkSeen(seen, 2) || field.value().get_string().get(text.content) != SUCCESS) {
+					return false;
+				}
+			}
+			else {
+				return false;
+			}
+		}
+		texts.push_back(text);
+	}
+	return true;
+}
+
+bool FastJson::ParseTextChat(const std::string& data, TextChatView& view) {
+	ondemand::document doc;
+	ondemand::object root;
+	if (!Iterate(data, doc) || doc.get_object().get(root) != SUCCESS) {
+		return false;
+	}
+
+	view.fromuid = 0;
+	view.touid = 0;
+	view.texts.clear();
+	unsigned seen = 0;
+	for (auto field : root) {
+		std::string_view key;
+		if (field.unescaped_key().get(key) != SUCCESS) {
+			return false;
+		}
+		if (key == "fromuid") {
+			if (!MarkSeen(seen, 1) || !GetInt(field.value(), view.fromuid)) {
+				return false;
+			}
+		}
+		else if (key == "touid") {
+			if (!MarkSeen(seen, 2) || !GetInt(field.value(), view.touid)) {
+				return false;
+			}
+		}
+		else if (key == "text_array") {
+			if (!MarkSeen(seen, 4) || !ParseTextArray(field.value(), view.texts)) {
+				return false;
+			}
+		}
+		else {
+			return false;
+		}
+	}
+	// 原始消息体会被原样转发，对象之后不能再有其他内容
+	return doc.at_end();
+}
@@ -0,0 +1,102 @@
+#include "HeartbeatWheel.h"
+#include "CSession.h"
+#include "LogicSystem.h"
+#include <iostream>
+
+HeartbeatWheel::HeartbeatWheel(boost::asio::io_context& io_context) :_io_context(io_context),
+_timer(io_context), _slots(HEARTBEAT_WHEEL_SLOTS), _cur_slot(0), _cur_tick_ms(NowMs()), _expired_count(0) {
+
+}
+
+int64_t HeartbeatWheel::NowMs() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void HeartbeatWheel::Start() {
+	auto self = shared_from_this();
+	boost::asio::post(_io_context, [self]() {
+		self->_cur_tick_ms = NowMs();
+		self->_timer.expires_after(std::chrono::milliseconds(HEARTBEAT_TICK_MS));
+		self->_timer.async_wait([self](const boost::system::error_code& ec) {
+			self->OnTick(ec);
+			});
+		});
+}
+
+void HeartbeatWheel::Stop() {
+	auto self = shared_from_this();
+	boost::asio::post(_io_context, [self]() {
+		self->_timer.cancel();
+		});
+}
+
+void HeartbeatWheel::Add(std::shared_ptr<CSession> session) {
+	auto self = shared_from_this();
+	boost::asio::post(_io_context, [self, session]() {
+		self->Schedule(session, session->GetLastHeartbeat() + HEARTBEAT_TIMEOUT_MS);
+		});
+}
+
+uint64_t HeartbeatWheel::GetExpiredCount() {
+	return _expired_count;
+}
+
+void HeartbeatWheel::Schedule(const std::shared_ptr<CSession>& session, int64_t deadline_ms) {
+	// 至少挂到下一个槽，超出一圈的截止时间先挂在最远的槽，到时再重新计算
+	int64_t ticks = (deadline_ms - _cur_tick_ms + HEARTBEAT_TICK_MS - 1) / HEARTBEAT_TICK_MS;
+	if (ticks < 1) {
+		ticks = 1;
+	}
+	if (ticks > HEARTBEAT_WHEEL_SLOTS - 1) {
+		ticks = HEARTBEAT_WHEEL_SLOTS - 1;
+	}
+	_slots[(_cur_slot + ticks) % HEARTBEAT_WHEEL_SLOTS].push_back(session);
+}
+
+void HeartbeatWheel::OnTick(const boost::system::error_code& ec) {
+	if (ec) {
+		return;
+	}
+
+	int64_t now = NowMs();
+	std::vector<std::weak_ptr<CSession>> due;
+	// 定时器可能晚到，把落后的槽都补走一遍
+	while (_cur_tick_ms + HEARTBEAT_TICK_MS <= now) {
+		_cur_tick_ms += HEARTBEAT_TICK_MS;
+		_cur_slot = (_cur_slot + 1) % HEARTBEAT_WHEEL_SLOTS;
+		due.swap(_slots[_cur_slot]);
+		for (auto& weak_session : due) {
+			auto session = weak_session.lock();
+			// 已经被清理的 session 直接丢弃
+			if (session == nullptr || !session->IsValid()) {
+				continue;
+			}
+
+			int64_t deadline = session->GetLastHeartbeat() + HEARTBEAT_TIMEOUT_MS;
+			if (deadline > now) {
+				Schedule(session, deadline);
+				continue;
+			}
+
+			Expire(session);
+		}
+		due.clear();
+	}
+
+	auto self = shared_from_this();
+	_timer.expires_after(std::chrono::milliseconds(HEARTBEAT_TICK_MS));
+	_timer.async_wait([self](const boost::system::error_code& ec) {
+		self->OnTick(ec);
+		});
+}
+
+void HeartbeatWheel::Expire(const std::shared_ptr<CSession>& session) {
+	std::cout << "heartbeat expired, session id is  " << session->GetSessionId() << std::endl;
+	_expired_count++;
+	session->Close();
+	// 解除 Redis 绑定是阻塞调用，交给 I/O 线程池，一批会话同时超时也不会卡住本 io_context 上的其他会话
+	LogicSystem::GetInstance()->RunDetached("heartbeat_expire", [session]() {
+		session->DealExceptionSession();
+	});
+}
@@ -5,29 +5,111 @@
 #include "RedisMgr.h"
 #include "UserMgr.h"
 #include "ChatGrpcClient.h"
-#include "DistLock.h"
 #include <string>
 #include "CServer.h"
+#include "PayloadCodec.h"
+#include "FastJson.h"
+#include "OfflineInbox.h"
+#include "MsgPersist.h"
+#include "UserInfoCache.h"
+#include "UserExistFilter.h"
+#include <thread>
 using namespace std;
 
-LogicSystem::LogicSystem():_b_stop(false), _p_server(nullptr){
-	RegisterCallBacks();
-	_worker_thread = std::thread (&LogicSystem::DealMsg, this);
+// 消息注册表，编译期生成，新增消息只需在这里加一行。心跳由 CSession 在 IO 线程直接应答，不在此表中
+constexpr LogicDispatchTable LogicSystem::_dispatch = {
+	{ MSG_CHAT_LOGIN, &LogicSystem::LoginHandler },
+	{ ID_SEARCH_USER_REQ, &LogicSystem::SearchInfo },
+	{ ID_ADD_FRIEND_REQ, &LogicSystem::AddFriendApply },
+	{ ID_AUTH_FRIEND_REQ, &LogicSystem::AuthFriendApply },
+	{ ID_TEXT_CHAT_MSG_REQ, &LogicSystem::DealChatTextMsg },
+};
+
+LogicSystem::LogicSystem():_capacity(MAX_RECVQUE), _b_stop(false), _p_server(nullptr){
+	// worker 数量可在 config.ini 的 [LogicSystem] Workers 中配置
+	std::size_t worker_count = LOGIC_WORKER_COUNT;
+	auto workers_str = ConfigMgr::Inst().GetValue("LogicSystem", "Workers");
+	if (!workers_str.empty() && std::stoi(workers_str) > 0) {
+		worker_count = std::stoi(workers_str);
+	}
+
+	std::size_t capacity = MAX_RECVQUE;
+	auto capacity_str = ConfigMgr::Inst().GetValue("LogicSystem", "QueueCapacity");
+	if (!capacity_str.empty() && std::stoi(capacity_str) > 0) {
+		capacity = std::stoi(capacity_str);
+	}
+	_capacity = capacity;
+
+	// 处理函数中的 Redis、MySQL 和 gRPC 调用在这个线程池上执行，数量在 [LogicSystem] IoThreads 中配置
+	std::size_t io_threads = LOGIC_IO_THREAD_COUNT;
+	auto io_threads_str = ConfigMgr::Inst().GetValue("LogicSystem", "IoThreads");
+	if (!io_threads_str.empty() && std::stoi(io_threads_str) > 0) {
+		io_threads = std::stoi(io_threads_str);
+	}
+	_io_pool = std::make_unique<boost::asio::thread_pool>(io_threads);
+
+	for (std::size_t i = 0; i < worker_count; ++i) {
+		_workers.push_back(std::make_unique<LogicWorker>(this, capacity));
+	}
+	std::cout << "logic system start with " << worker_count << " workers, queue capacity "
+		<< capacity << ", io threads " << io_threads << std::endl;
 }
 
 LogicSystem::~LogicSystem(){
+	// 1) 不再接收新的客户端消息
 	_b_stop = true;
-	_consume.notify_one();
-	_worker_thread.join();
+	// 2) worker 照常运行，等在途的 I/O 阶段和它们的续体、暂存的消息都处理完，
+	//    期间续体可能再发起新的阶段，I/O 线程池仍可用
+	for (;;) {
+		bool b_idle = GetInflightCount() == 0;
+		for (auto& worker : _workers) {
+			b_idle = b_idle && worker->GetQueueDepth() == 0;
+		}
+		if (b_idle) {
+			break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	// 3) I/O 线程池已经空闲，先停掉它，再逐个停止 worker
+	_io_pool->join();
+	_workers.clear();
 }
 
-void LogicSystem::PostMsgToQue(shared_ptr < LogicNode> msg) {
-	std::unique_lock<std::mutex> unique_lk(_mutex);
-	_msg_que.push(msg);
-	if (_msg_que.size() == 1) {
-		unique_lk.unlock();
-		_consume.notify_one();
+bool LogicSystem::PostMsgToQue(shared_ptr < LogicNode> msg) {
+	if (_b_stop) {
+		return false;
 	}
+	// 同一 session 的消息固定落到同一个 worker，保证单用户有序，不同用户并行
+	auto index = msg->_session->GetRouteHash() % _workers.size();
+	return _workers[index]->PostMsgToQue(std::move(msg));
+}
+
+std::size_t LogicSystem::GetQueueCapacity() {
+	return _capacity;
+}
+
+int64_t LogicSystem::GetMaxQueueWaitUs() {
+	int64_t max_wait_us = 0;
+	for (auto& worker : _workers) {
+		max_wait_us = (std::max)(max_wait_us, worker->GetQueueWaitUs());
+	}
+	return max_wait_us;
+}
+
+std::vector<std::size_t> LogicSystem::GetQueueDepths() {
+	std::vector<std::size_t> depths;
+	for (auto& worker : _workers) {
+		depths.push_back(worker->GetQueueDepth());
+	}
+	return depths;
+}
+
+uint64_t LogicSystem::GetRejectedCount() {
+	uint64_t rejected = 0;
+	for (auto& worker : _workers) {
+		rejected += worker->GetRejectedCount();
+	}
+	return rejected;
 }
 
 
@@ -36,204 +118,282 @@ void LogicSystem::SetServer(std::shared_ptr<CServer> pserver) {
 }
 
 
-void LogicSystem::DealMsg() {
-	for (;;) {
-		std::unique_lock<std::mutex> unique_lk(_mutex);
-		while (_msg_que.empty() && !_b_stop) {
-			_consume.wait(unique_lk);
-		}
+bool LogicSystem::IsKnownMsg(short msg_id) {
+	return _dispatch.Contains(msg_id);
+}
 
-		if (_b_stop ) {
-			while (!_msg_que.empty()) {
-				auto msg_node = _msg_que.front();
-				cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-				auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-				if (call_back_iter == _fun_callbacks.end()) {
-					_msg_que.pop();
-					continue;
-				}
-				call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id,
-					std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-				_msg_que.pop();
-			}
-			break;
+void LogicSystem::Dispatch(std::shared_ptr<CSession> session, short msg_id, const string& msg_data) {
+	auto handler = _dispatch.Find(msg_id);
+	if (handler == nullptr) {
+		std::cout << "msg id [" << msg_id << "] handler not found" << std::endl;
+		return;
+	}
+	(this->*handler)(session, msg_id, msg_data);
+}
+
+void LogicSystem::Await(std::shared_ptr<CSession> session, const char* stage,
+	std::function<void()> io, std::function<void()> then) {
+	auto worker = LogicWorker::Current();
+	if (worker == nullptr) {
+		io();
+		then();
+		return;
+	}
+
+	worker->BeginAsync(session);
+	auto cls = worker->GetCurrentClass();
+	auto start = std::chrono::steady_clock::now();
+	boost::asio::post(*_io_pool, [this, worker, session, cls, stage, io, then, start]() {
+		try {
+			io();
 		}
+		catch (std::exception& e) {
+			std::cout << "async stage " << stage << " failed, error is " << e.what() << std::endl;
+		}
+		RecordStage(stage, start);
+		// 无论成败都要回到 worker，续体里发应答并释放该 session 暂存的消息
+		worker->PostTask(session, cls, then);
+	});
+}
 
-		auto msg_node = _msg_que.front();
-		cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-		auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-		if (call_back_iter == _fun_callbacks.end()) {
-			_msg_que.pop();
-			std::cout << "msg id [" << msg_node->_recvnode->_msg_id << "] handler not found" << std::endl;
-			continue;
+void LogicSystem::RunDetached(const char* stage, std::function<void()> io) {
+	auto start = std::chrono::steady_clock::now();
+	boost::asio::post(*_io_pool, [this, stage, io, start]() {
+		try {
+			io();
 		}
-		call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id, 
-			std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-		_msg_que.pop();
-	}
+		catch (std::exception& e) {
+			std::cout << "detached stage " << stage << " failed, error is " << e.what() << std::endl;
+		}
+		RecordStage(stage, start);
+	});
 }
 
-void LogicSystem::RegisterCallBacks() {
-	_fun_callbacks[MSG_CHAT_LOGIN] = std::bind(&LogicSystem::LoginHandler, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+void LogicSystem::AwaitTimer(std::shared_ptr<CSession> session, std::chrono::milliseconds delay,
+	std::function<void()> then) {
+	auto worker = LogicWorker::Current();
+	if (worker == nullptr) {
+		then();
+		return;
+	}
+
+	// 定时器挂在 I/O 线程池上，析构时先等在途阶段结束再停线程池，等待中的定时器总能触发
+	worker->BeginAsync(session);
+	auto cls = worker->GetCurrentClass();
+	auto timer = std::make_shared<boost::asio::steady_timer>(_io_pool->get_executor(), delay);
+	timer->async_wait([worker, session, cls, then, timer](const boost::system::error_code&) {
+		worker->PostTask(session, cls, then);
+	});
+}
 
-	_fun_callbacks[ID_SEARCH_USER_REQ] = std::bind(&LogicSystem::SearchInfo, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+void LogicSystem::RecordStage(const char* stage, std::chrono::steady_clock::time_point start) {
+	uint64_t cost_us = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start).count();
+	std::lock_guard<std::mutex> lock(_stage_mtx);
+	auto& stat = _stage_stats[stage];
+	stat.count++;
+	stat.total_us += cost_us;
+	if (cost_us > stat.max_us) {
+		stat.max_us = cost_us;
+	}
+}
 
-	_fun_callbacks[ID_ADD_FRIEND_REQ] = std::bind(&LogicSystem::AddFriendApply, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+uint64_t LogicSystem::GetInflightCount() {
+	return LogicWorker::GetInflightCount();
+}
 
-	_fun_callbacks[ID_AUTH_FRIEND_REQ] = std::bind(&LogicSystem::AuthFriendApply, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+void LogicSystem::GetNameLoadStats(uint64_t& loads, uint64_t& coalesced) {
+	_name_loads.GetStats(loads, coalesced);
+}
 
-	_fun_callbacks[ID_TEXT_CHAT_MSG_REQ] = std::bind(&LogicSystem::DealChatTextMsg, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+LatencyStat LogicSystem::TakeQueueLatency(int cls) {
+	return LogicWorker::TakeQueueLatency(cls);
+}
 
-	_fun_callbacks[ID_HEART_BEAT_REQ] = std::bind(&LogicSystem::HeartBeatHandler, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
-	
+std::map<std::string, StageStat> LogicSystem::GetStageStats() {
+	std::lock_guard<std::mutex> lock(_stage_mtx);
+	return _stage_stats;
 }
 
 void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short &msg_id, const string &msg_data) {
-	json root = json::parse(msg_data, /*callback=*/nullptr, /*allow_exceptions=*/false);
-	json rtvalue; // 最终返回给客户端的 JSON
-	Defer defer([&rtvalue, session]() {
-        std::string return_str = rtvalue.dump();   // 如需可读性可用 dump(2)
-        session->Send(return_str, MSG_CHAT_LOGIN_RSP);
-    });
+	// 登录包的编码决定整个会话的负载格式
+	bool binary = PayloadCodec::IsBinaryLogin(msg_data);
+	session->SetBinaryPayload(binary);
+
+	ChatLoginReq root;
+	// 最终返回给客户端的应答，在各阶段之间共享
+	auto rtvalue = std::make_shared<ChatLoginRsp>();
+	auto send_rsp = [rtvalue, session, binary]() {
+		session->Send(PayloadCodec::Encode(*rtvalue, binary), MSG_CHAT_LOGIN_RSP);
+	};
 
     // 基本健壮性：解析失败或字段缺失 => 直接返回错误
-    if (root.is_discarded() || !root.is_object()) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // 若有 ParamInvalid 更合适可替换
+    if (!PayloadCodec::Decode(msg_data, binary, root)) {
+        rtvalue->set_error(ErrorCodes::UidInvalid); // 若有 ParamInvalid 更合适可替换
+        send_rsp();
         return;
     }
-    int uid = root.value("uid", 0);
-    std::string token = root.value("token", std::string{});
+    int uid = root.uid();
+    std::string token = root.token();
     if (uid == 0 || token.empty()) {
-        rtvalue["error"] = ErrorCodes::UidInvalid;
+        rtvalue->set_error(ErrorCodes::UidInvalid);
+        send_rsp();
         return;
     }
 
-    std::cout << "user login uid is " << uid
-              << " user token is " << token << std::endl;
+	// 一次 Redis 脚本完成 token 校验、旧登录查询、会话绑定并带回基础信息缓存，
+	// 再读好友申请和好友列表，都在 I/O 线程池执行
+	auto bind = std::make_shared<LoginBindResult>();
+	Await(session, "login", [this, session, uid, token, bind, rtvalue]() {
+		auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
+		if (!BindLoginSession(session, uid, token, server_name, *bind, *rtvalue)) {
+			return;
+		}
+
+		// 旧登录在其他服务器：释放绑定锁之后再通过 gRPC 通知远端踢下线，
+		// 两台服务器同时登录同一用户时不会互相等待
+		if (bind->b_old && bind->old_server != server_name) {
+			KickUserReq kick_req;
+			kick_req.set_uid(uid);
+			ChatGrpcClient::GetInstance()->NotifyKickUser(bind->old_server, kick_req);
+		}
+	}, [this, session, uid, rtvalue, send_rsp]() {
+		if (rtvalue->error() != ErrorCodes::Success) {
+			send_rsp();
+			return;
+		}
+		// 登录应答不等离线消息，之后再分页补发
+		send_rsp();
+		DrainOfflineInbox(session, uid, nullptr);
+	});
+}
 
-	// 校验 token（Redis）
-	const std::string uid_str   = std::to_string(uid);
-    const std::string token_key = USERTOKENPREFIX + uid_str;
+void LogicSystem::DrainOfflineInbox(std::shared_ptr<CSession> session, int uid, std::shared_ptr<OfflinePage> acked) {
+	// 每个阶段确认上一页并取下一页，一次只在内存里放一页，积压再多登录也不会被拖慢
+	auto page = std::make_shared<OfflinePage>();
+	Await(session, "offline_drain", [uid, acked, page]() {
+		auto inbox = OfflineInbox::GetInstance();
+		long long after_id = 0;
+		if (acked) {
+			if (!inbox->Ack(uid, *acked)) {
+				return;
+			}
+			after_id = acked->max_id;
+		}
+		inbox->Fetch(uid, after_id, *page);
+	}, [this, session, uid, page]() {
+		SendOfflinePage(session, uid, page, 0);
+	});
+}
 
-    std::string token_value;
-	bool success = RedisMgr::GetInstance()->Get(token_key, token_value);
-	if (!success) {
-		rtvalue["error"] = ErrorCodes::UidInvalid;
-		return ;
+void LogicSystem::SendOfflinePage(std::shared_ptr<CSession> session, int uid, std::shared_ptr<OfflinePage> page,
+	int waited_ms) {
+	// 会话已失效的不确认，剩余消息留在收件箱等下次登录
+	if (page->entries.empty() || !session->IsValid() || session->GetUserId() != uid) {
+		return;
 	}
 
-	if (token_value != token) {
-		rtvalue["error"] = ErrorCodes::TokenInvalid;
-		return ;
+	// 客户端读得慢时先等发送队列消化，避免补发把会话推到硬上限被踢掉。
+	// 用定时器隔一段时间再看，不在 I/O 线程上睡眠；等太久就放弃，这一页不确认
+	if (session->GetSendQueueBytes() > CSession::GetSendLowWater()) {
+		if (waited_ms >= OFFLINE_DRAIN_WAIT_MS) {
+			return;
+		}
+		AwaitTimer(session, std::chrono::milliseconds(OFFLINE_DRAIN_RETRY_MS), [this, session, uid, page, waited_ms]() {
+			SendOfflinePage(session, uid, page, waited_ms + OFFLINE_DRAIN_RETRY_MS);
+		});
+		return;
 	}
 
-	rtvalue["error"] = ErrorCodes::Success;
+	for (auto& frame : OfflineInbox::EncodeFrames(*page)) {
+		session->Send(frame, ID_NOTIFY_OFFLINE_MSG_BATCH);
+	}
+	DrainOfflineInbox(session, uid, page);
+}
 
-	// 用户基础信息：先 Redis，失败回源 MySQL
-	std::string base_key = USER_BASE_INFO + uid_str;
-	auto user_info = std::make_shared<UserInfo>();
-	bool b_base = GetBaseInfo(base_key, uid, user_info);
+void LogicSystem::LoadLoginInfo(int uid, const LoginBindResult& bind, ChatLoginRsp& rtvalue) {
+	// 用户基础信息：脚本已带回 Redis 缓存，顺带填充进程内缓存，未命中或损坏时走完整的查找
+	std::shared_ptr<UserInfo> user_info;
+	bool b_base = bind.b_base && UserInfoCache::GetInstance()->Put(uid, bind.base_info, user_info);
 	if (!b_base) {
-		rtvalue["error"] = ErrorCodes::UidInvalid;
+		b_base = UserInfoCache::GetInstance()->Get(uid, user_info);
+	}
+	if (!b_base) {
+		rtvalue.set_error(ErrorCodes::UidInvalid);
 		return;
 	}
 	// 基础信息填充
-    rtvalue["uid"]   = uid;
-    rtvalue["pwd"]   = user_info->pwd;
-    rtvalue["name"]  = user_info->name;
-    rtvalue["email"] = user_info->email;
-    rtvalue["nick"]  = user_info->nick;
-    rtvalue["desc"]  = user_info->desc;
-    rtvalue["sex"]   = user_info->sex;
-    rtvalue["icon"]  = user_info->icon;
+    rtvalue.set_uid(uid);
+    rtvalue.set_pwd(user_info->pwd);
+    rtvalue.set_name(user_info->name);
+    rtvalue.set_email(user_info->email);
+    rtvalue.set_nick(user_info->nick);
+    rtvalue.set_desc(user_info->desc);
+    rtvalue.set_sex(user_info->sex);
+    rtvalue.set_icon(user_info->icon);
 
 	// 读取好友申请列表
     std::vector<std::shared_ptr<ApplyInfo>> apply_list;
     if (GetFriendApplyInfo(uid, apply_list)) {
-        json apply_arr = json::array();
         for (const auto& apply : apply_list) {
-            apply_arr.push_back({
-                {"name",   apply->_name},
-                {"uid",    apply->_uid},
-                {"icon",   apply->_icon},
-                {"nick",   apply->_nick},
-                {"sex",    apply->_sex},
-                {"desc",   apply->_desc},
-                {"status", apply->_status}
-            });
+            auto* apply_info = rtvalue.add_apply_list();
+            apply_info->set_name(apply->_name);
+            apply_info->set_uid(apply->_uid);
+            apply_info->set_icon(apply->_icon);
+            apply_info->set_nick(apply->_nick);
+            apply_info->set_sex(apply->_sex);
+            apply_info->set_desc(apply->_desc);
+            apply_info->set_status(apply->_status);
         }
-        rtvalue["apply_list"] = std::move(apply_arr);    
     }
 
 	// 读取好友列表
     std::vector<std::shared_ptr<UserInfo>> friend_list;
     if (GetFriendList(uid, friend_list)) {
-		json friend_arr = json::array();
 		for (const auto& f : friend_list) {
-			friend_arr.push_back({
-				{"name",  f->name},
-				{"uid",   f->uid},
-				{"icon",  f->icon},
-				{"nick",  f->nick},
-				{"sex",   f->sex},
-				{"desc",  f->desc},
-				{"back",  f->back}
-			});
+			auto* friend_info = rtvalue.add_friend_list();
+			friend_info->set_name(f->name);
+			friend_info->set_uid(f->uid);
+			friend_info->set_icon(f->icon);
+			friend_info->set_nick(f->nick);
+			friend_info->set_sex(f->sex);
+			friend_info->set_desc(f->desc);
+			friend_info->set_back(f->back);
 		}
-		rtvalue["friend_list"] = std::move(friend_arr);
     }
+}
 
-	// 分布式踢下线 + 绑定会话
-	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
-    {
-        // 分布式锁，避免并发登录竞态
-        const auto lock_key   = LOCK_PREFIX + uid_str;
-        const auto identifier = RedisMgr::GetInstance()->acquireLock(lock_key, LOCK_TIME_OUT, ACQUIRE_TIME_OUT);
-        Defer defer2([identifier, lock_key]() {
-            RedisMgr::GetInstance()->releaseLock(lock_key, identifier);
-        });
-
-		// 检测旧登录
-        std::string uid_ip_value;
-        const auto uid_ip_key = USERIPPREFIX + uid_str;
-        bool b_ip = RedisMgr::GetInstance()->Get(uid_ip_key, uid_ip_value);
-
-		if (b_ip) {
-            // 已经在某台服务器登录
-            auto& cfg = ConfigMgr::Inst();
-            auto self_name = cfg["SelfServer"]["Name"];
-
-            if (uid_ip_value == self_name) {
-                // 就在本机：踢旧连接
-                auto old_session = UserMgr::GetInstance()->GetSession(uid);
-                if (old_session) {
-                    old_session->NotifyOffline(uid);
-                    _p_server->ClearSession(old_session->GetSessionId());
-                }
-            } else {
-                // 不在本机：通过 gRPC 通知远端踢下线
-                KickUserReq kick_req;
-                kick_req.set_uid(uid);
-                ChatGrpcClient::GetInstance()->NotifyKickUser(uid_ip_value, kick_req);
-            }
-        }
+bool LogicSystem::BindLoginSession(std::shared_ptr<CSession> session, int uid, const std::string& token,
+	const std::string& server_name, LoginBindResult& bind, ChatLoginRsp& rtvalue) {
+	// 同一用户的并发登录可能落在不同 worker 上，远端的踢人也可能同时到达。
+	// Redis 绑定到本机映射更新之间持有该 uid 的绑定锁，两者的先后顺序一致，
+	// 远端踢人要等本机映射更新后才会执行，不会漏踢刚绑定的会话
+	std::lock_guard<std::mutex> lock(UserMgr::GetInstance()->GetBindMutex(uid));
+	if (!RedisMgr::GetInstance()->LoginBind(uid, token, server_name, session->GetSessionId(), bind)) {
+		bind.error = ErrorCodes::UidInvalid;
+	}
+	rtvalue.set_error(bind.error);
+	if (bind.error != ErrorCodes::Success) {
+		return false;
+	}
 
-		// 绑定当前会话
-        session->SetUserId(uid);
-        RedisMgr::GetInstance()->Set(uid_ip_key, server_name);
-        UserMgr::GetInstance()->SetUserSession(uid, session);
+	// 读取资料失败时撤销绑定，不让 Redis 指向一个不会生效的会话
+	LoadLoginInfo(uid, bind, rtvalue);
+	if (rtvalue.error() != ErrorCodes::Success) {
+		RedisMgr::GetInstance()->RollbackBind(uid, session->GetSessionId(), bind);
+		return false;
+	}
 
-        const std::string uid_session_key = USER_SESSION_PREFIX + uid_str;
-        RedisMgr::GetInstance()->Set(uid_session_key, session->GetSessionId());
-    }
+	// 本机的旧连接直接踢掉，只踢不是自己的那个
+	auto old_session = UserMgr::GetInstance()->GetSession(uid);
+	if (old_session && old_session != session) {
+		old_session->NotifyOffline(uid);
+		_p_server->ClearSession(old_session->GetSessionId());
+	}
 
-	return;
+	session->SetUserId(uid);
+	UserMgr::GetInstance()->SetUserSession(uid, session);
+	return true;
 }
 
 void LogicSystem::SearchInfo(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
@@ -241,29 +401,40 @@ void LogicSystem::SearchInfo(std::shared_ptr<CSession> session, const short& msg
     // 1) 解析输入（非抛异常）
     json root = json::parse(msg_data, /*callback=*/nullptr, /*allow_exceptions=*/false);
 
-    json rtvalue;
-    Defer defer([&rtvalue, session]() {
-        std::string return_str = rtvalue.dump(); // 调试期可用 dump(2)
+    auto rtvalue = std::make_shared<json>();
+    auto send_rsp = [rtvalue, session]() {
+        std::string return_str = rtvalue->dump(); // 调试期可用 dump(2)
         session->Send(return_str, ID_SEARCH_USER_RSP);
-    });
+    };
 
     if (root.is_discarded() || !root.is_object()) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // 或者 ParamInvalid
+        (*rtvalue)["error"] = ErrorCodes::UidInvalid; // 或者 ParamInvalid
+        send_rsp();
         return;
     }
 
     std::string uid_str = root.value("uid", std::string{});
-    std::cout << "user SearchInfo uid is " << uid_str << std::endl;
-
-    // 2) 分支调用
-    if (isPureDigit(uid_str)) {
-        // 注意：把 GetUserByUid 的签名改成：GetUserByUid(const std::string&, nlohmann::json& out)
-        GetUserByUid(uid_str, rtvalue);
-    } else {
-        // 同理：GetUserByName(const std::string&, nlohmann::json& out)
-        GetUserByName(uid_str, rtvalue);
+
+    // 2) 名字查询走内存索引，按相关度返回前缀和容错匹配，不访问 Redis 和 MySQL
+    if (!isPureDigit(uid_str)) {
+        auto index = UserSearchIndex::GetInstance();
+        auto hits = index->Search(uid_str, index->GetTopK());
+        // 索引首轮加载完成前查不到，回退到按名字精确查询
+        if (!hits.empty() || index->IsReady()) {
+            FillSearchHits(hits, *rtvalue);
+            send_rsp();
+            return;
+        }
     }
-    return;
+
+    // 3) 分支调用，Redis 未命中时会回源 MySQL
+    Await(session, "search_user", [this, uid_str, rtvalue]() {
+        if (isPureDigit(uid_str)) {
+            GetUserByUid(uid_str, *rtvalue);
+        } else {
+            GetUserByName(uid_str, *rtvalue);
+        }
+    }, send_rsp);
 }
 
 void LogicSystem::AddFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
@@ -271,15 +442,16 @@ void LogicSystem::AddFriendApply(std::shared_ptr<CSession> session, const short&
 	// 1) 解析输入（非抛异常）
     json root = json::parse(msg_data, /*callback=*/nullptr, /*allow_exceptions=*/false);
 
-    json rtvalue;
-    rtvalue["error"] = ErrorCodes::Success;
-    Defer defer([&rtvalue, session]() {
-        std::string return_str = rtvalue.dump();
+    auto rtvalue = std::make_shared<json>();
+    (*rtvalue)["error"] = ErrorCodes::Success;
+    auto send_rsp = [rtvalue, session]() {
+        std::string return_str = rtvalue->dump();
         session->Send(return_str, ID_ADD_FRIEND_RSP);
-    });
+    };
 
     if (root.is_discarded() || !root.is_object()) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // 或 ParamInvalid
+        (*rtvalue)["error"] = ErrorCodes::UidInvalid; // 或 ParamInvalid
+        send_rsp();
         return;
     }
 
@@ -288,72 +460,90 @@ void LogicSystem::AddFriendApply(std::shared_ptr<CSession> session, const short&
     std::string bakname     = root.value("bakname", std::string{}); // 你当前未使用
     int touid               = root.value("touid", 0);
 
-    std::cout << "user login uid is " << uid
-              << " applyname is " << applyname
-              << " bakname is "   << bakname
-              << " touid is "     << touid << std::endl;
-
     if (uid == 0 || touid == 0 || applyname.empty()) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // 或 ParamInvalid
+        (*rtvalue)["error"] = ErrorCodes::UidInvalid; // 或 ParamInvalid
+        send_rsp();
         return;
     }
 
-	// 2) 先写数据库
-    MysqlMgr::GetInstance()->AddFriendApply(uid, touid);
+    struct ApplyCtx {
+        bool b_ip = false;
+        std::string to_ip_value;
+        bool b_info = false;
+        std::shared_ptr<UserInfo> apply_info = std::make_shared<UserInfo>();
+    };
+    auto ctx = std::make_shared<ApplyCtx>();
+
+    // 本机下发和存入离线收件箱用同一份通知
+    auto make_notify = [uid, applyname, ctx]() {
+        AddFriendNotify notify;
+        notify.set_error(ErrorCodes::Success);
+        notify.set_applyuid(uid);
+        notify.set_name(applyname);
+        notify.set_desc(""); // 和你原逻辑一致
+        if (ctx->b_info) {
+            notify.set_icon(ctx->apply_info->icon);
+            notify.set_sex(ctx->apply_info->sex);
+            notify.set_nick(ctx->apply_info->nick);
+        }
+        return notify;
+    };
+
+    Await(session, "add_friend_apply", [this, uid, touid, ctx, make_notify]() {
+        // 2) 先写数据库
+        MysqlMgr::GetInstance()->AddFriendApply(uid, touid);
 
-    // 3) 查询对端所在服务器
-    const std::string to_str    = std::to_string(touid);
-    const std::string to_ip_key = USERIPPREFIX + to_str;
-    std::string to_ip_value;
-    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);
-    if (!b_ip) {
-        // 未找到就直接返回（rtvalue 仍是 Success）
-        return;
-    }
+        // 3) 查询对端所在服务器
+        ctx->b_ip = RedisMgr::GetInstance()->Get(USERIPPREFIX + std::to_string(touid), ctx->to_ip_value);
 
-    auto& cfg        = ConfigMgr::Inst();
-    auto self_name   = cfg["SelfServer"]["Name"];
-
-
-	// 4) 查发起者的基础信息（用于通知 payload）
-    const std::string base_key = USER_BASE_INFO + std::to_string(uid);
-    auto apply_info = std::make_shared<UserInfo>();
-    bool b_info = GetBaseInfo(base_key, uid, apply_info);
-
-	// 5) 在本机：直接推送
-    if (to_ip_value == self_name) {
-        auto peer_session = UserMgr::GetInstance()->GetSession(touid); // 避免遮蔽入参 session
-        if (peer_session) {
-            json notify = {
-                {"error",    ErrorCodes::Success},
-                {"applyuid", uid},
-                {"name",     applyname},
-                {"desc",     ""} // 和你原逻辑一致
-            };
-            if (b_info) {
-                notify["icon"] = apply_info->icon;
-                notify["sex"]  = apply_info->sex;
-                notify["nick"] = apply_info->nick;
-            }
-            peer_session->Send(notify.dump(), ID_NOTIFY_ADD_FRIEND_REQ);
+        // 4) 查发起者的基础信息（用于通知 payload）
+        ctx->b_info = UserInfoCache::GetInstance()->Get(uid, ctx->apply_info);
+
+        // 5) 对端不在线：存入离线收件箱，登录时补发（rtvalue 仍是 Success）
+        if (!ctx->b_ip) {
+            OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_ADD_FRIEND_REQ,
+                PayloadCodec::Encode(make_notify(), false));
+        }
+    }, [this, session, uid, touid, applyname, ctx, send_rsp, make_notify]() {
+        if (!ctx->b_ip) {
+            send_rsp();
+            return;
         }
-        return;
-	}
 
-	
-	// 6) 不在本机：通过 gRPC 通知对端
-    AddFriendReq add_req;
-    add_req.set_applyuid(uid);
-    add_req.set_touid(touid);
-    add_req.set_name(applyname);
-    add_req.set_desc(""); // 原逻辑
-    if (b_info) {
-        add_req.set_icon(apply_info->icon);
-        add_req.set_sex(apply_info->sex);
-        add_req.set_nick(apply_info->nick);
-    }
-    ChatGrpcClient::GetInstance()->NotifyAddFriend(to_ip_value, add_req);
+        auto& cfg        = ConfigMgr::Inst();
+        auto self_name   = cfg["SelfServer"]["Name"];
+
+        // 6) 在本机：直接推送，会话已断开则存入离线收件箱
+        if (ctx->to_ip_value == self_name) {
+            auto peer_session = UserMgr::GetInstance()->GetSession(touid); // 避免遮蔽入参 session
+            if (peer_session) {
+                peer_session->Send(PayloadCodec::Encode(make_notify(), peer_session->IsBinaryPayload()),
+                    ID_NOTIFY_ADD_FRIEND_REQ);
+                send_rsp();
+                return;
+            }
+            auto body = PayloadCodec::Encode(make_notify(), false);
+            Await(session, "offline_push", [touid, body]() {
+                OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_ADD_FRIEND_REQ, body);
+            }, send_rsp);
+            return;
+        }
 
+        // 7) 不在本机：通过 gRPC 通知对端
+        AddFriendReq add_req;
+        add_req.set_applyuid(uid);
+        add_req.set_touid(touid);
+        add_req.set_name(applyname);
+        add_req.set_desc(""); // 原逻辑
+        if (ctx->b_info) {
+            add_req.set_icon(ctx->apply_info->icon);
+            add_req.set_sex(ctx->apply_info->sex);
+            add_req.set_nick(ctx->apply_info->nick);
+        }
+        Await(session, "add_friend_notify", [ctx, add_req]() {
+            ChatGrpcClient::GetInstance()->NotifyAddFriend(ctx->to_ip_value, add_req);
+        }, send_rsp);
+    });
 }
 
 void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data) {
@@ -362,17 +552,18 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
     json root = json::parse(msg_data, /*callback=*/nullptr, /*allow_exceptions=*/false);
 
     // 应答体
-    json rtvalue;
-    rtvalue["error"] = ErrorCodes::Success;
+    auto rtvalue = std::make_shared<json>();
+    (*rtvalue)["error"] = ErrorCodes::Success;
 
     // 统一应答发送
-    Defer defer([&rtvalue, session]() {
-        std::string return_str = rtvalue.dump();   // 生产用 dump()；调试可 dump(2)
+    auto send_rsp = [rtvalue, session]() {
+        std::string return_str = rtvalue->dump();   // 生产用 dump()；调试可 dump(2)
         session->Send(return_str, ID_AUTH_FRIEND_RSP);
-    });
+    };
 
     if (root.is_discarded() || !root.is_object()) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // 或 ParamInvalid
+        (*rtvalue)["error"] = ErrorCodes::UidInvalid; // 或 ParamInvalid
+        send_rsp();
         return;
     }
 
@@ -380,161 +571,246 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
     int touid    = root.value("touid", 0);
     std::string back_name = root.value("back", std::string{});
 
-    std::cout << "from " << uid << " auth friend to " << touid << std::endl;
-
-    // 查询对端（被添加者）基本信息，填充应答
-    auto user_info = std::make_shared<UserInfo>();
-    const std::string base_key = USER_BASE_INFO + std::to_string(touid);
-    bool b_info = GetBaseInfo(base_key, touid, user_info);
-    if (b_info) {
-        rtvalue["name"] = user_info->name;
-        rtvalue["nick"] = user_info->nick;
-        rtvalue["icon"] = user_info->icon;
-        rtvalue["sex"]  = user_info->sex;
-        rtvalue["uid"]  = touid;
-    } else {
-        rtvalue["error"] = ErrorCodes::UidInvalid;
-    }
-
-    // 先更新数据库（同原逻辑）
-	MysqlMgr::GetInstance()->AuthFriendApply(uid, touid);
-	MysqlMgr::GetInstance()->AddFriend(uid, touid,back_name);
+    struct AuthCtx {
+        bool b_info = false;
+        std::shared_ptr<UserInfo> user_info = std::make_shared<UserInfo>();
+        bool b_ip = false;
+        std::string to_ip_value;
+        bool b_local = false;
+        bool b_from_info = false;
+        std::shared_ptr<UserInfo> from_info = std::make_shared<UserInfo>();
+    };
+    auto ctx = std::make_shared<AuthCtx>();
+
+    // 本机下发和存入离线收件箱用同一份通知
+    auto make_notify = [uid, touid, ctx]() {
+        AuthFriendNotify notify;
+        notify.set_error(ErrorCodes::Success);
+        notify.set_fromuid(uid);
+        notify.set_touid(touid);
+        if (ctx->b_from_info) {
+            notify.set_name(ctx->from_info->name);
+            notify.set_nick(ctx->from_info->nick);
+            notify.set_icon(ctx->from_info->icon);
+            notify.set_sex(ctx->from_info->sex);
+        } else {
+            notify.set_error(ErrorCodes::UidInvalid);
+        }
+        return notify;
+    };
 
-	// 查询对端所在服务器
-    const std::string to_ip_key = USERIPPREFIX + std::to_string(touid);
-    std::string to_ip_value;
-    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);
-    if (!b_ip) {
-        return; // 找不到在线位置
-    }
+    Await(session, "auth_friend_apply", [this, uid, touid, back_name, ctx, make_notify]() {
+        // 查询对端（被添加者）基本信息，填充应答
+        ctx->b_info = UserInfoCache::GetInstance()->Get(touid, ctx->user_info);
+
+        // 先更新数据库（同原逻辑）
+        MysqlMgr::GetInstance()->AuthFriendApply(uid, touid);
+        MysqlMgr::GetInstance()->AddFriend(uid, touid, back_name);
+        InvalidateFriendList(uid, touid);
+
+        // 查询对端所在服务器
+        const std::string to_ip_key = USERIPPREFIX + std::to_string(touid);
+        ctx->b_ip = RedisMgr::GetInstance()->Get(to_ip_key, ctx->to_ip_value);
+
+        auto& cfg      = ConfigMgr::Inst();
+        auto self_name = cfg["SelfServer"]["Name"];
+        ctx->b_local   = ctx->b_ip && ctx->to_ip_value == self_name;
+        if (ctx->b_local || !ctx->b_ip) {
+            // 补充 fromuid 的基本信息，用于通知本机的对端或存入离线收件箱
+            ctx->b_from_info = UserInfoCache::GetInstance()->Get(uid, ctx->from_info);
+        }
 
-	auto& cfg      = ConfigMgr::Inst();
-    auto self_name = cfg["SelfServer"]["Name"];
-	// 就在本机：直接通知对端
-    if (to_ip_value == self_name) {
-        auto peer_session = UserMgr::GetInstance()->GetSession(touid); // 避免遮蔽形参 session
-        if (peer_session) {
-            json notify = {
-                {"error",   ErrorCodes::Success},
-                {"fromuid", uid},
-                {"touid",   touid},
-            };
-
-            // 补充 fromuid 的基本信息
-            const std::string base_key2 = USER_BASE_INFO + std::to_string(uid);
-            auto from_info = std::make_shared<UserInfo>();
-            bool b_info2 = GetBaseInfo(base_key2, uid, from_info);
-            if (b_info2) {
-                notify["name"] = from_info->name;
-                notify["nick"] = from_info->nick;
-                notify["icon"] = from_info->icon;
-                notify["sex"]  = from_info->sex;
-            } else {
-                notify["error"] = ErrorCodes::UidInvalid;
-            }
+        // 找不到在线位置：存入离线收件箱，登录时补发
+        if (!ctx->b_ip) {
+            OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_AUTH_FRIEND_REQ,
+                PayloadCodec::Encode(make_notify(), false));
+        }
+    }, [this, session, uid, touid, ctx, rtvalue, send_rsp, make_notify]() {
+        if (ctx->b_info) {
+            (*rtvalue)["name"] = ctx->user_info->name;
+            (*rtvalue)["nick"] = ctx->user_info->nick;
+            (*rtvalue)["icon"] = ctx->user_info->icon;
+            (*rtvalue)["sex"]  = ctx->user_info->sex;
+            (*rtvalue)["uid"]  = touid;
+        } else {
+            (*rtvalue)["error"] = ErrorCodes::UidInvalid;
+        }
 
-            peer_session->Send(notify.dump(), ID_NOTIFY_AUTH_FRIEND_REQ);
+        if (!ctx->b_ip) {
+            send_rsp();
+            return;
         }
-        return;
-	}
 
+        // 就在本机：直接通知对端，会话已断开则存入离线收件箱
+        if (ctx->b_local) {
+            auto peer_session = UserMgr::GetInstance()->GetSession(touid); // 避免遮蔽形参 session
+            if (peer_session) {
+                peer_session->Send(PayloadCodec::Encode(make_notify(), peer_session->IsBinaryPayload()),
+                    ID_NOTIFY_AUTH_FRIEND_REQ);
+                send_rsp();
+                return;
+            }
+            auto body = PayloadCodec::Encode(make_notify(), false);
+            Await(session, "offline_push", [touid, body]() {
+                OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_AUTH_FRIEND_REQ, body);
+            }, send_rsp);
+            return;
+        }
 
-	// 不在本机：通过 gRPC 通知对端
-    AuthFriendReq auth_req;
-    auth_req.set_fromuid(uid);
-    auth_req.set_touid(touid);
-    ChatGrpcClient::GetInstance()->NotifyAuthFriend(to_ip_value, auth_req);
+        // 不在本机：通过 gRPC 通知对端
+        AuthFriendReq auth_req;
+        auth_req.set_fromuid(uid);
+        auth_req.set_touid(touid);
+        Await(session, "auth_friend_notify", [ctx, auth_req]() {
+            ChatGrpcClient::GetInstance()->NotifyAuthFriend(ctx->to_ip_value, auth_req);
+        }, send_rsp);
+    });
 }
 
-void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data) {
-	// 解析输入（非抛异常）
-    json root = json::parse(msg_data, /*callback=*/nullptr, /*allow_exceptions=*/false);
-
-    // 统一应答对象
-    json rtvalue;
-    rtvalue["error"] = ErrorCodes::Success;
-
-    Defer defer([&rtvalue, session]() {
-        std::string return_str = rtvalue.dump();
-        session->Send(return_str, ID_TEXT_CHAT_MSG_RSP);
-    });
+// 一条文本聊天消息在各阶段之间共享的内容。应答和本机通知的内容相同：
+// JSON 会话另外保留补上 error 字段的原始消息体，双方都是 JSON 会话时直接复用；
+// req 在解析输入时一次填好，之后各阶段只读
+struct TextChatFrame {
+	bool binary = false;
+	std::string json_body;
+	bool has_req = false;
+	TextChatMsgReq req;
+
+	std::string Encode(bool peer_binary) const {
+		if (!binary && !peer_binary) {
+			return json_body;
+		}
+		TextChatMsgRsp rsp;
+		rsp.set_error(ErrorCodes::Success);
+		rsp.set_fromuid(req.fromuid());
+		rsp.set_touid(req.touid());
+		*rsp.mutable_textmsgs() = req.textmsgs();
+		return PayloadCodec::Encode(rsp, peer_binary);
+	}
+};
 
-    if (root.is_discarded() || !root.is_object()) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // 或 ParamInvalid
-        return;
+void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data) {
+	// 按会话协商的负载格式解析输入
+    auto frame = std::make_shared<TextChatFrame>();
+    frame->binary = session->IsBinaryPayload();
+    int touid = 0;
+    // 待落库的消息，只拷贝 msgid 和内容，转发仍复用原始消息体
+    auto records = std::make_shared<std::vector<ChatRecord>>();
+    auto now_ms = MsgPersist::NowMs();
+    if (frame->binary) {
+        frame->has_req = PayloadCodec::Decode(msg_data, true, frame->req);
+        touid = frame->req.touid();
+        for (const auto& text : frame->req.textmsgs()) {
+            ChatRecord record;
+            record.fromuid = frame->req.fromuid();
+            record.touid = touid;
+            record.msgid = text.msgid();
+            record.content = text.msgcontent();
+            record.send_time = now_ms;
+            records->push_back(std::move(record));
+        }
     }
-
-    int uid   = root.value("fromuid", 0);
-    int touid = root.value("touid", 0);
-
-    // text_array：容错处理（缺失或类型不对时给空数组）
-    json arrays = json::array();
-    if (root.contains("text_array") && root["text_array"].is_array()) {
-        arrays = root["text_array"];
+    else {
+        // 不构造 DOM，解析结果直接填进 req；原始消息体校验过后才拼接 error 字段
+        TextChatView view;
+        if (FastJson::ParseTextChat(msg_data, view)) {
+            frame->json_body = PayloadCodec::WithError(msg_data, ErrorCodes::Success);
+            frame->req.set_fromuid(view.fromuid);
+            frame->req.set_touid(view.touid);
+            touid = view.touid;
+            for (const auto& text : view.texts) {
+                auto* text_msg = frame->req.add_textmsgs();
+                text_msg->set_msgid(text.msgid.data(), text.msgid.size());
+                text_msg->set_msgcontent(text.content.data(), text.content.size());
+
+                ChatRecord record;
+                record.fromuid = view.fromuid;
+                record.touid = touid;
+                record.msgid.assign(text.msgid);
+                record.content.assign(text.content);
+                record.send_time = now_ms;
+                records->push_back(std::move(record));
+            }
+            frame->has_req = true;
+        }
     }
 
-    // 填充应答
-    rtvalue["fromuid"]    = uid;
-    rtvalue["touid"]      = touid;
-    rtvalue["text_array"] = arrays;
-
-
-	// 查询对端所在服务器
-    const std::string to_ip_key = USERIPPREFIX + std::to_string(touid);
-    std::string to_ip_value;
-    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);
-    if (!b_ip) {
+    if (!frame->has_req) {
+        session->Send(PayloadCodec::EncodeError(ErrorCodes::UidInvalid, frame->binary), ID_TEXT_CHAT_MSG_RSP);
         return;
     }
 
-    auto& cfg      = ConfigMgr::Inst();
-    auto self_name = cfg["SelfServer"]["Name"];
-	// 本机：直接下发通知
-    if (to_ip_value == self_name) {
-        auto peer_session = UserMgr::GetInstance()->GetSession(touid);
-        if (peer_session) {
-            peer_session->Send(rtvalue.dump(), ID_NOTIFY_TEXT_CHAT_MSG_REQ);
-        }
-        return;
-    }
+    // 应答回显请求内容
+    auto send_rsp = [session, frame]() {
+        session->Send(frame->Encode(frame->binary), ID_TEXT_CHAT_MSG_RSP);
+    };
+
+    auto send_busy = [session, frame]() {
+        session->Send(PayloadCodec::EncodeError(ErrorCodes::ServerBusy, frame->binary), ID_TEXT_CHAT_MSG_RSP);
+    };
 
-	// 跨机：组织 gRPC 请求
-    TextChatMsgReq text_msg_req;
-    text_msg_req.set_fromuid(uid);
-    text_msg_req.set_touid(touid);
-	// 逐条拷贝消息
-    if (arrays.is_array()) {
-        for (const auto& txt_obj : arrays) {
-            // 容错：缺字段给默认值
-            std::string content = txt_obj.value("content", std::string{});
-            std::string msgid   = txt_obj.value("msgid", std::string{});
-
-            std::cout << "content is " << content << std::endl;
-            std::cout << "msgid is "   << msgid   << std::endl;
-
-            auto* text_msg = text_msg_req.add_textmsgs();
-            text_msg->set_msgid(msgid);
-            text_msg->set_msgcontent(content);
+    struct RouteCtx {
+        bool b_ip = false;
+        std::string to_ip_value;
+        bool b_local = false;
+        bool b_busy = false;
+    };
+    auto ctx = std::make_shared<RouteCtx>();
+
+	// 查询对端所在服务器，不在线就存入离线收件箱，登录时补发
+    Await(session, "chat_route", [touid, frame, ctx, records]() {
+        const std::string to_ip_key = USERIPPREFIX + std::to_string(touid);
+        ctx->b_ip = RedisMgr::GetInstance()->Get(to_ip_key, ctx->to_ip_value);
+        ctx->b_local = ctx->b_ip && ctx->to_ip_value == ConfigMgr::Inst().GetValue("SelfServer", "Name");
+
+        // 跨机消息由对端服务器落库，落库积压时拒绝本条，不再投递
+        if (!ctx->b_ip || ctx->b_local) {
+            ctx->b_busy = !MsgPersist::GetInstance()->Enqueue(std::move(*records));
+            if (ctx->b_busy) {
+                return;
+            }
         }
-    }
 
+        if (!ctx->b_ip) {
+            OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_TEXT_CHAT_MSG_REQ, frame->Encode(false));
+        }
+    }, [this, session, touid, frame, ctx, send_rsp, send_busy]() {
+        if (ctx->b_busy) {
+            send_busy();
+            return;
+        }
 
-	// 调用对端
-    ChatGrpcClient::GetInstance()->NotifyTextChatMsg(to_ip_value, text_msg_req, rtvalue);
-}
+        if (!ctx->b_ip) {
+            send_rsp();
+            return;
+        }
 
-void LogicSystem::HeartBeatHandler(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data) {
-	json root = json::parse(msg_data, /*callback=*/nullptr, /*allow_exceptions=*/false);
-    int uid = 0;
-    if (!root.is_discarded() && root.is_object()) {
-        uid = root.value("fromuid", 0);
-    }
-    std::cout << "receive heart beat msg, uid is " << uid << std::endl;
+        // 本机：直接下发通知，双方都是 JSON 会话时原样转发；会话已断开则存入离线收件箱
+        if (ctx->b_local) {
+            auto peer_session = UserMgr::GetInstance()->GetSession(touid);
+            if (peer_session) {
+                peer_session->Send(frame->Encode(peer_session->IsBinaryPayload()), ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+                send_rsp();
+                return;
+            }
+            Await(session, "offline_push", [touid, frame]() {
+                OfflineInbox::GetInstance()->Push(touid, ID_NOTIFY_TEXT_CHAT_MSG_REQ, frame->Encode(false));
+            }, send_rsp);
+            return;
+        }
 
-    json rtvalue = {
-        {"error", ErrorCodes::Success}
-    };
-    session->Send(rtvalue.dump(), ID_HEARTBEAT_RSP);
+        // 跨机：通过 gRPC 转发 protobuf
+        Await(session, "chat_forward", [ctx, frame]() {
+            auto rsp = ChatGrpcClient::GetInstance()->NotifyTextChatMsg(ctx->to_ip_value, frame->req);
+            ctx->b_busy = rsp.error() == ErrorCodes::ServerBusy;
+        }, [ctx, send_rsp, send_busy]() {
+            if (ctx->b_busy) {
+                send_busy();
+                return;
+            }
+            send_rsp();
+        });
+    });
 }
 
 bool LogicSystem::isPureDigit(const std::string& str)
@@ -552,41 +828,6 @@ void LogicSystem::GetUserByUid(std::string uid_str, json& rtvalue)
 {
 	rtvalue["error"] = ErrorCodes::Success;
 
-	std::string base_key = USER_BASE_INFO + uid_str;
-
-	// 先查 Redis
-	std::string info_str;
-	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-	if (b_base) {
-        json root = json::parse(info_str, /*callback=*/nullptr, /*allow_exceptions=*/false);
-        if (!root.is_discarded() && root.is_object()) {
-            int         uid   = root.value("uid",   0);
-            std::string name  = root.value("name",  std::string{});
-            std::string pwd   = root.value("pwd",   std::string{});
-            std::string email = root.value("email", std::string{});
-            std::string nick  = root.value("nick",  std::string{});
-            std::string desc  = root.value("desc",  std::string{});
-            int         sex   = root.value("sex",   0);
-            std::string icon  = root.value("icon",  std::string{});
-
-            std::cout << "user uid is " << uid << " name is "
-                      << name << " pwd is " << pwd << " email is "
-                      << email << " icon is " << icon << std::endl;
-
-            rtvalue["uid"]   = uid;
-            rtvalue["pwd"]   = pwd;
-            rtvalue["name"]  = name;
-            rtvalue["email"] = email;
-            rtvalue["nick"]  = nick;
-            rtvalue["desc"]  = desc;
-            rtvalue["sex"]   = sex;
-            rtvalue["icon"]  = icon;
-            return;
-        }
-        // 解析失败则回源 DB
-    }
-
-	// Redis 未命中或损坏：查 DB
     int uid = 0;
     try {
         uid = std::stoi(uid_str);
@@ -595,25 +836,13 @@ void LogicSystem::GetUserByUid(std::string uid_str, json& rtvalue)
         return;
     }
 
-    std::shared_ptr<UserInfo> user_info = MysqlMgr::GetInstance()->GetUser(uid);
-    if (!user_info) {
+	// 依次查进程内缓存、Redis 和 DB，不存在的 uid 也会被缓存一段时间
+    std::shared_ptr<UserInfo> user_info;
+    if (!UserInfoCache::GetInstance()->Get(uid, user_info)) {
         rtvalue["error"] = ErrorCodes::UidInvalid;
         return;
     }
 
-	// 写回 Redis
-    json redis_root = {
-        {"uid",   user_info->uid},
-        {"pwd",   user_info->pwd},
-        {"name",  user_info->name},
-        {"email", user_info->email},
-        {"nick",  user_info->nick},
-        {"desc",  user_info->desc},
-        {"sex",   user_info->sex},
-        {"icon",  user_info->icon}
-    };
-    RedisMgr::GetInstance()->Set(base_key, redis_root.dump());
-
 	// 返回
     rtvalue["uid"]   = user_info->uid;
     rtvalue["pwd"]   = user_info->pwd;
@@ -625,10 +854,46 @@ void LogicSystem::GetUserByUid(std::string uid_str, json& rtvalue)
     rtvalue["icon"]  = user_info->icon;
 }
 
+void LogicSystem::FillSearchHits(const std::vector<SearchHit>& hits, json& rtvalue)
+{
+	if (hits.empty()) {
+		rtvalue["error"] = ErrorCodes::UidInvalid;
+		return;
+	}
+
+	// 最相关的一条放在顶层，兼容只读单个用户的客户端，全部结果放在 matches 中
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["uid"]   = hits[0].uid;
+	rtvalue["name"]  = hits[0].name;
+	rtvalue["nick"]  = hits[0].nick;
+	rtvalue["desc"]  = hits[0].desc;
+	rtvalue["sex"]   = hits[0].sex;
+	rtvalue["icon"]  = hits[0].icon;
+
+	json matches = json::array();
+	for (auto& hit : hits) {
+		matches.push_back({
+			{"uid",  hit.uid},
+			{"name", hit.name},
+			{"nick", hit.nick},
+			{"desc", hit.desc},
+			{"sex",  hit.sex},
+			{"icon", hit.icon}
+		});
+	}
+	rtvalue["matches"] = std::move(matches);
+}
+
 void LogicSystem::GetUserByName(std::string name, json& rtvalue)
 {
 	rtvalue["error"] = ErrorCodes::Success;
 
+	// 过滤器判定不存在的名字直接返回，不查 Redis 和 MySQL
+	if (!UserExistFilter::GetInstance()->MayHaveName(name)) {
+		rtvalue["error"] = ErrorCodes::UidInvalid;
+		return;
+	}
+
 	std::string base_key = NAME_INFO + name;
 
 	// 先查 Redis
@@ -646,10 +911,6 @@ void LogicSystem::GetUserByName(std::string name, json& rtvalue)
             int         sex   = root.value("sex",   0);
             // 注意：你原实现这里没有 icon 字段，保持一致；若需要也可加上
 
-            std::cout << "user uid is " << uid << " name is "
-                      << uname << " pwd is " << pwd << " email is "
-                      << email << std::endl;
-
 			rtvalue["uid"]   = uid;
             rtvalue["pwd"]   = pwd;
             rtvalue["name"]  = uname;
@@ -662,25 +923,32 @@ void LogicSystem::GetUserByName(std::string name, json& rtvalue)
 		// 解析失败则回源 DB
 	}
 
-	// Redis 未命中：查 DB
-    std::shared_ptr<UserInfo> user_info = MysqlMgr::GetInstance()->GetUser(name);
+	// Redis 未命中：查 DB 并写回，同一个名字的并发查询只回源一次
+    auto user_info = _name_loads.Do(name, [&name, &base_key]() {
+        std::shared_ptr<UserInfo> user_info = MysqlMgr::GetInstance()->GetUser(name);
+        if (!user_info) {
+            UserExistFilter::GetInstance()->CountFalsePositive(name);
+            return user_info;
+        }
+
+        // 写回 Redis（保持与你原实现一致：不写 icon）
+        json redis_root = {
+            {"uid",   user_info->uid},
+            {"pwd",   user_info->pwd},
+            {"name",  user_info->name},
+            {"email", user_info->email},
+            {"nick",  user_info->nick},
+            {"desc",  user_info->desc},
+            {"sex",   user_info->sex}
+        };
+        RedisMgr::GetInstance()->Set(base_key, redis_root.dump());
+        return user_info;
+    });
     if (!user_info) {
         rtvalue["error"] = ErrorCodes::UidInvalid;
         return;
     }
 
-	// 写回 Redis（保持与你原实现一致：不写 icon）
-    json redis_root = {
-        {"uid",   user_info->uid},
-        {"pwd",   user_info->pwd},
-        {"name",  user_info->name},
-        {"email", user_info->email},
-        {"nick",  user_info->nick},
-        {"desc",  user_info->desc},
-        {"sex",   user_info->sex}
-    };
-    RedisMgr::GetInstance()->Set(base_key, redis_root.dump());
-
     // 返回
     rtvalue["uid"]   = user_info->uid;
     rtvalue["pwd"]   = user_info->pwd;
@@ -691,60 +959,98 @@ void LogicSystem::GetUserByName(std::string name, json& rtvalue)
     rtvalue["sex"]   = user_info->sex;
 }
 
-bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
-{
-	// 先查 Redis
-	std::string info_str;
-    bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-    if (b_base) {
-        json root = json::parse(info_str, /*callback=*/nullptr, /*allow_exceptions=*/false);
-        if (!root.is_discarded() && root.is_object()) {
-            if (!userinfo) userinfo = std::make_shared<UserInfo>();
-            userinfo->uid   = root.value("uid",   0);
-            userinfo->name  = root.value("name",  std::string{});
-            userinfo->pwd   = root.value("pwd",   std::string{});
-            userinfo->email = root.value("email", std::string{});
-            userinfo->nick  = root.value("nick",  std::string{});
-            userinfo->desc  = root.value("desc",  std::string{});
-            userinfo->sex   = root.value("sex",   0);
-            userinfo->icon  = root.value("icon",  std::string{});
-
-            std::cout << "user login uid is " << userinfo->uid
-                      << " name is " << userinfo->name
-                      << " pwd is "  << userinfo->pwd
-                      << " email is " << userinfo->email << std::endl;
-            return true;
-        }
-        // Redis 命中但 JSON 异常：继续回源 DB
-    }
-
-    // 回源 DB
-    std::shared_ptr<UserInfo> user_info = MysqlMgr::GetInstance()->GetUser(uid);
-    if (!user_info) {
-        return false;
-    }
-    userinfo = user_info;
-
-    // 写回 Redis
-    json redis_root = {
-        {"uid",   uid},
-        {"pwd",   userinfo->pwd},
-        {"name",  userinfo->name},
-        {"email", userinfo->email},
-        {"nick",  userinfo->nick},
-        {"desc",  userinfo->desc},
-        {"sex",   userinfo->sex},
-        {"icon",  userinfo->icon}
-    };
-    RedisMgr::GetInstance()->Set(base_key, redis_root.dump());
+bool LogicSystem::GetFriendApplyInfo(int to_uid, std::vector<std::shared_ptr<ApplyInfo>> &list) {
+	return MysqlMgr::GetInstance()->GetApplyList(to_uid, list, 0, 10);
+}
 
-    return true;
+// 好友列表在 Redis 中的紧凑格式：每个好友一个数组 [uid, name, nick, desc, sex, icon, back]
+static std::string EncodeFriendList(const std::vector<std::shared_ptr<UserInfo>>& user_list) {
+	json root = json::array();
+	for (const auto& f : user_list) {
+		root.push_back({ f->uid, f->name, f->nick, f->desc, f->sex, f->icon, f->back });
+	}
+	return root.dump();
 }
 
-bool LogicSystem::GetFriendApplyInfo(int to_uid, std::vector<std::shared_ptr<ApplyInfo>> &list) {
-	return MysqlMgr::GetInstance()->GetApplyList(to_uid, list, 0, 10);
+static bool DecodeFriendList(const std::string& list_str, std::vector<std::shared_ptr<UserInfo>>& user_list) {
+	json root = json::parse(list_str, /*callback=*/nullptr, /*allow_exceptions=*/false);
+	if (root.is_discarded() || !root.is_array()) {
+		return false;
+	}
+
+	std::vector<std::shared_ptr<UserInfo>> decoded;
+	decoded.reserve(root.size());
+	try {
+		for (const auto& item : root) {
+			if (!item.is_array() || item.size() != 7) {
+				return false;
+			}
+			auto user_info = std::make_shared<UserInfo>();
+			user_info->uid = item[0].get<int>();
+			user_info->name = item[1].get<std::string>();
+			user_info->nick = item[2].get<std::string>();
+			user_info->desc = item[3].get<std::string>();
+			user_info->sex = item[4].get<int>();
+			user_info->icon = item[5].get<std::string>();
+			user_info->back = item[6].get<std::string>();
+			decoded.push_back(user_info);
+		}
+	}
+	catch (json::exception& e) {
+		std::cout << "friend list cache invalid: " << e.what() << std::endl;
+		return false;
+	}
+	user_list.swap(decoded);
+	return true;
 }
 
+// KEYS[1] 好友列表缓存，KEYS[2] 版本号；ARGV[1] 查询前读到的版本号，ARGV[2] 列表，ARGV[3] 过期秒数。
+// 版本号变了说明查询期间好友关系有变化，读到的列表可能已过时，不写回
+static const std::string FRIEND_LIST_SET_SCRIPT = R"(
+local ver = redis.call('GET', KEYS[2]) or '0'
+if ver ~= ARGV[1] then
+	return 0
+end
+redis.call('SET', KEYS[1], ARGV[2], 'EX', ARGV[3])
+return 1
+)";
+
 bool LogicSystem::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>>& user_list) {
-	return MysqlMgr::GetInstance()->GetFriendList(self_id, user_list);
+	// 先查 Redis 中的缓存，未命中再联表查询并写回
+	std::string list_key = FRIEND_LIST_PREFIX + std::to_string(self_id);
+	std::string list_str;
+	if (RedisMgr::GetInstance()->Get(list_key, list_str) && DecodeFriendList(list_str, user_list)) {
+		return true;
+	}
+
+	// 版本号要在查 MySQL 之前读，读不到按 0 处理，脚本里比对不上只是少写一次缓存
+	std::string ver_key = FRIEND_LIST_VER_PREFIX + std::to_string(self_id);
+	std::string ver;
+	if (!RedisMgr::GetInstance()->Get(ver_key, ver)) {
+		ver = "0";
+	}
+
+	if (!MysqlMgr::GetInstance()->GetFriendList(self_id, user_list)) {
+		return false;
+	}
+
+	RedisValue reply;
+	RedisMgr::GetInstance()->EvalScript(FRIEND_LIST_SET_SCRIPT, { list_key, ver_key },
+		{ ver, EncodeFriendList(user_list), std::to_string(FRIEND_LIST_TTL) }, reply);
+	return true;
+}
+
+// 好友关系变化后先自增双方的版本号再删除缓存，下次登录时重新查询。
+// 自增之前已经写回的旧列表被随后的 DEL 删掉，之后才写回的会因版本号不同而放弃
+void LogicSystem::InvalidateFriendList(int uid, int touid) {
+	std::vector<std::vector<std::string>> cmds;
+	for (int id : { uid, touid }) {
+		std::string ver_key = FRIEND_LIST_VER_PREFIX + std::to_string(id);
+		cmds.push_back({ "INCR", ver_key });
+		cmds.push_back({ "EXPIRE", ver_key, std::to_string(FRIEND_LIST_TTL) });
+	}
+	cmds.push_back({ "DEL", FRIEND_LIST_PREFIX + std::to_string(uid), FRIEND_LIST_PREFIX + std::to_string(touid) });
+
+	std::vector<RedisValue> replies;
+	RedisMgr::GetInstance()->Pipeline(cmds, replies);
 }
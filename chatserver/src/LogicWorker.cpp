@@ -0,0 +1,288 @@
+#include "LogicWorker.h"
+#include "LogicSystem.h"
+#include <iostream>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+std::atomic<uint64_t> LogicWorker::_inflight_count(0);
+LatencyRecorder LogicWorker::_queue_latency[MSG_CLASS_COUNT];
+static thread_local LogicWorker* t_current_worker = nullptr;
+
+#ifdef __linux__
+// eventfd 计数加一，被信号打断时重试
+static void SignalEventFd(int fd) {
+	uint64_t one = 1;
+	while (write(fd, &one, sizeof(one)) != sizeof(one)) {
+		if (errno != EINTR) {
+			std::cout << "eventfd write failed, error is " << strerror(errno) << std::endl;
+			return;
+		}
+	}
+}
+
+// 阻塞到计数非零并清零，被信号打断时重试
+static void WaitEventFd(int fd) {
+	uint64_t value = 0;
+	while (read(fd, &value, sizeof(value)) != sizeof(value)) {
+		if (errno != EINTR) {
+			std::cout << "eventfd read failed, error is " << strerror(errno) << std::endl;
+			return;
+		}
+	}
+}
+#endif
+
+LogicWorker::LogicWorker(LogicSystem* logic, std::size_t capacity) :_logic(logic),
+_depth(0), _capacity(capacity), _current_class(MsgClassBulk), _queue_wait_us(0), _rejected(0), _b_sleeping(false), _b_stop(false) {
+	for (auto& depth : _class_depth) {
+		depth = 0;
+	}
+#ifdef __linux__
+	_event_fd = eventfd(0, EFD_CLOEXEC);
+#endif
+	_worker_thread = std::thread(&LogicWorker::DealMsg, this);
+}
+
+LogicWorker::~LogicWorker() {
+	_b_stop = true;
+	_b_sleeping = false;
+#ifdef __linux__
+	SignalEventFd(_event_fd);
+#else
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+	}
+	_consume.notify_one();
+#endif
+	_worker_thread.join();
+#ifdef __linux__
+	close(_event_fd);
+#endif
+}
+
+bool LogicWorker::PostMsgToQue(shared_ptr<LogicNode> msg) {
+	// 先占名额再入队，超过上限直接拒绝，不让积压无限增长。
+	// 各类别分开计数，批量消息把队列占满时登录仍能进来
+	auto& class_depth = _class_depth[msg->_class];
+	if (class_depth.fetch_add(1) >= _capacity) {
+		class_depth.fetch_sub(1);
+		_rejected++;
+		return false;
+	}
+
+	_depth.fetch_add(1);
+	Enqueue(std::move(msg));
+	return true;
+}
+
+void LogicWorker::PostTask(shared_ptr<CSession> session, MsgClass cls, std::function<void()> task) {
+	// 续体必须执行，否则 session 会一直处于挂起状态，所以不做容量检查
+	_class_depth[cls].fetch_add(1);
+	_depth.fetch_add(1);
+	Enqueue(MakePooled<LogicNode>(std::move(session), cls, std::move(task)));
+}
+
+// 调用方已经占好名额
+void LogicWorker::Enqueue(shared_ptr<LogicNode> msg) {
+	// 入队期间由节点自己持有引用，出队时交还给 worker
+	LogicNode* node = msg.get();
+	node->_enqueue_us = LatencyRecorder::NowUs();
+	node->_self_ref = std::move(msg);
+	_msg_que[node->_class].Push(node);
+	Wake();
+}
+
+LogicWorker* LogicWorker::Current() {
+	return t_current_worker;
+}
+
+MsgClass LogicWorker::GetCurrentClass() {
+	return _current_class;
+}
+
+LatencyStat LogicWorker::TakeQueueLatency(int cls) {
+	return _queue_latency[cls].Take();
+}
+
+uint64_t LogicWorker::GetInflightCount() {
+	return _inflight_count.load(std::memory_order_relaxed);
+}
+
+void LogicWorker::BeginAsync(const shared_ptr<CSession>& session) {
+	_pending[session.get()].inflight++;
+	_inflight_count++;
+}
+
+// 该 session 的异步阶段全部完成后，按原顺序处理暂存的消息，遇到再次挂起就停下
+void LogicWorker::EndAsync(const shared_ptr<CSession>& session) {
+	auto iter = _pending.find(session.get());
+	if (iter == _pending.end()) {
+		return;
+	}
+	_inflight_count--;
+	if (--iter->second.inflight > 0) {
+		return;
+	}
+
+	auto deferred = std::move(iter->second.deferred);
+	_pending.erase(iter);
+	while (!deferred.empty()) {
+		auto msg_node = deferred.front();
+		deferred.pop_front();
+		_class_depth[msg_node->_class].fetch_sub(1, std::memory_order_relaxed);
+		Dispatch(msg_node);
+		auto again = _pending.find(session.get());
+		if (again != _pending.end()) {
+			again->second.deferred = std::move(deferred);
+			return;
+		}
+	}
+}
+
+std::size_t LogicWorker::GetQueueDepth() {
+	return _depth.load(std::memory_order_relaxed);
+}
+
+int64_t LogicWorker::GetQueueWaitUs() {
+	return _queue_wait_us.load(std::memory_order_relaxed);
+}
+
+uint64_t LogicWorker::GetRejectedCount() {
+	return _rejected.load(std::memory_order_relaxed);
+}
+
+// worker 正在睡眠时才需要唤醒，多个生产者只有一个会真正发出信号
+void LogicWorker::Wake() {
+	if (!_b_sleeping.load() || !_b_sleeping.exchange(false)) {
+		return;
+	}
+#ifdef __linux__
+	SignalEventFd(_event_fd);
+#else
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+	}
+	_consume.notify_one();
+#endif
+}
+
+void LogicWorker::WaitForMsg() {
+	_b_sleeping = true;
+	// 置位后再检查一次，和 PostMsgToQue 中的先入队后检查配对，避免丢失唤醒
+	if (_depth.load() > 0 || _b_stop.load()) {
+		_b_sleeping = false;
+		return;
+	}
+#ifdef __linux__
+	WaitEventFd(_event_fd);
+#else
+	std::unique_lock<std::mutex> unique_lk(_mutex);
+	_consume.wait(unique_lk, [this]() {
+		return !_b_sleeping.load();
+		});
+#endif
+	_b_sleeping = false;
+}
+
+// 按权重轮流从各类别队列取，控制类每轮先取，积压的批量消息不会把它挤到批次末尾之后
+void LogicWorker::PopBatch(std::vector<shared_ptr<LogicNode>>& batch) {
+	const int* weights = MsgClassWeights();
+	int64_t now_us = LatencyRecorder::NowUs();
+	int64_t max_wait_us = 0;
+	bool b_more = true;
+	while (b_more && batch.size() < LOGIC_BATCH_SIZE) {
+		b_more = false;
+		for (int cls = 0; cls < MSG_CLASS_COUNT; ++cls) {
+			int taken = 0;
+			while (taken < weights[cls] && batch.size() < LOGIC_BATCH_SIZE) {
+				LogicNode* node = _msg_que[cls].Pop();
+				if (node == nullptr) {
+					break;
+				}
+				int64_t wait_us = now_us - node->_enqueue_us;
+				_queue_latency[cls].Record(wait_us);
+				if (wait_us > max_wait_us) {
+					max_wait_us = wait_us;
+				}
+				batch.push_back(std::move(node->_self_ref));
+				_class_depth[cls].fetch_sub(1, std::memory_order_relaxed);
+				_depth.fetch_sub(1, std::memory_order_release);
+				taken++;
+			}
+			// 取满了权重说明该类别可能还有，再来一轮
+			if (taken == weights[cls]) {
+				b_more = true;
+			}
+		}
+	}
+	_queue_wait_us.store(max_wait_us, std::memory_order_relaxed);
+}
+
+void LogicWorker::DealMsg() {
+	t_current_worker = this;
+	std::vector<shared_ptr<LogicNode>> batch;
+	batch.reserve(LOGIC_BATCH_SIZE);
+	for (;;) {
+		PopBatch(batch);
+		if (batch.empty()) {
+			// 退出前把剩余消息处理完
+			if (_b_stop && _depth.load() == 0) {
+				break;
+			}
+			// 名额已占但节点还没链上，说明生产者正在入队，让出时间片后重试
+			if (_depth.load() > 0) {
+				std::this_thread::yield();
+				continue;
+			}
+			WaitForMsg();
+			continue;
+		}
+
+		// 回调里会访问 Redis、MySQL 和 gRPC，整批处理期间不与 IO 线程争用任何锁
+		for (auto& msg_node : batch) {
+			HandleMsg(msg_node);
+		}
+		batch.clear();
+	}
+}
+
+void LogicWorker::HandleMsg(const shared_ptr<LogicNode>& msg_node) {
+	_current_class = msg_node->_class;
+	if (msg_node->_task) {
+		// 续体抛异常也要结束这次异步阶段，否则该 session 暂存的消息永远不会再处理
+		Defer defer([this, &msg_node]() {
+			EndAsync(msg_node->_session);
+			});
+		try {
+			msg_node->_task();
+		}
+		catch (std::exception& e) {
+			std::cout << "async continuation failed, error is " << e.what() << std::endl;
+		}
+		return;
+	}
+
+	// 前一条消息还在等 I/O，排在它后面。暂存期间继续占用所属类别的队列名额，
+	// 某个阶段很慢时客户端持续发送，会被 PostMsgToQue 拒绝而不是无限堆积
+	auto iter = _pending.find(msg_node->_session.get());
+	if (iter != _pending.end()) {
+		_class_depth[msg_node->_class].fetch_add(1, std::memory_order_relaxed);
+		iter->second.deferred.push_back(msg_node);
+		return;
+	}
+	Dispatch(msg_node);
+}
+
+void LogicWorker::Dispatch(const shared_ptr<LogicNode>& msg_node) {
+	// 暂存后补处理的消息不经过 HandleMsg，这里再设一次
+	_current_class = msg_node->_class;
+	// 尾部预留 JSON_PADDING，FastJson 可以直接在这块内存上解析
+	std::string msg_data;
+	msg_data.reserve(msg_node->_recvnode->_cur_len + JSON_PADDING);
+	msg_data.assign(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len);
+	_logic->Dispatch(msg_node->_session, msg_node->_recvnode->_msg_id, msg_data);
+}
@@ -0,0 +1,26 @@
+#include "MsgClass.h"
+#include "ConfigMgr.h"
+
+struct MsgClassWeightTable {
+	int weights[MSG_CLASS_COUNT];
+};
+
+// 读取 [Priority] 配置，缺省时使用 const.h 中的默认值
+const int* MsgClassWeights() {
+	static const MsgClassWeightTable table = []() {
+		MsgClassWeightTable cfg;
+		cfg.weights[MsgClassControl] = MSG_CLASS_CONTROL_WEIGHT;
+		cfg.weights[MsgClassBulk] = MSG_CLASS_BULK_WEIGHT;
+		auto& mgr = ConfigMgr::Inst();
+		auto control_str = mgr.GetValue("Priority", "ControlWeight");
+		auto bulk_str = mgr.GetValue("Priority", "BulkWeight");
+		if (!control_str.empty() && std::stoi(control_str) > 0) {
+			cfg.weights[MsgClassControl] = std::stoi(control_str);
+		}
+		if (!bulk_str.empty() && std::stoi(bulk_str) > 0) {
+			cfg.weights[MsgClassBulk] = std::stoi(bulk_str);
+		}
+		return cfg;
+	}();
+	return table.weights;
+}
@@ -0,0 +1,106 @@
+#include "MsgNodePool.h"
+#include <algorithm>
+
+static const std::size_t s_class_sizes[MsgNodePool::CLASS_COUNT] = { 64, 256, 1024, 4096, 16384 };
+
+struct MsgNodePool::LocalCache {
+	std::vector<char*> _lists[CLASS_COUNT];
+	~LocalCache() {
+		//线程退出时把缓存的块还给全局仓库
+		for (std::size_t i = 0; i < CLASS_COUNT; ++i) {
+			MsgNodePool::Inst().Release(i, _lists[i], _lists[i].size());
+		}
+	}
+};
+
+static thread_local MsgNodePool::LocalCache t_cache;
+
+MsgNodePool& MsgNodePool::Inst() {
+	static MsgNodePool pool;
+	return pool;
+}
+
+MsgNodePool::~MsgNodePool() {
+	for (std::size_t i = 0; i < CLASS_COUNT; ++i) {
+		for (auto* block : _depot[i]) {
+			delete[] block;
+		}
+		_depot[i].clear();
+	}
+}
+
+std::size_t MsgNodePool::ClassIndex(std::size_t size) {
+	for (std::size_t i = 0; i < CLASS_COUNT; ++i) {
+		if (size <= s_class_sizes[i]) {
+			return i;
+		}
+	}
+	return CLASS_COUNT;
+}
+
+std::size_t MsgNodePool::ClassSize(std::size_t index) {
+	return s_class_sizes[index];
+}
+
+char* MsgNodePool::Alloc(std::size_t size) {
+	_alloc_count.fetch_add(1, std::memory_order_relaxed);
+	auto index = ClassIndex(size);
+	if (index == CLASS_COUNT) {
+		_oversize_count.fetch_add(1, std::memory_order_relaxed);
+		_malloc_count.fetch_add(1, std::memory_order_relaxed);
+		return new char[size];
+	}
+
+	auto& local = t_cache._lists[index];
+	if (local.empty()) {
+		Refill(index, local);
+	}
+
+	if (local.empty()) {
+		_malloc_count.fetch_add(1, std::memory_order_relaxed);
+		return new char[s_class_sizes[index]];
+	}
+
+	char* block = local.back();
+	local.pop_back();
+	return block;
+}
+
+void MsgNodePool::Free(char* ptr, std::size_t size) {
+	if (ptr == nullptr) {
+		return;
+	}
+
+	auto index = ClassIndex(size);
+	if (index == CLASS_COUNT) {
+		delete[] ptr;
+		return;
+	}
+
+	auto& local = t_cache._lists[index];
+	local.push_back(ptr);
+	if (local.size() > LOCAL_CACHE_MAX) {
+		Release(index, local, TRANSFER_BATCH);
+	}
+}
+
+void MsgNodePool::Refill(std::size_t index, std::vector<char*>& local) {
+	std::lock_guard<std::mutex> lock(_depot_mtx[index]);
+	auto& depot = _depot[index];
+	std::size_t count = (std::min)(depot.size(), TRANSFER_BATCH);
+	local.insert(local.end(), depot.end() - count, depot.end());
+	depot.resize(depot.size() - count);
+}
+
+void MsgNodePool::Release(std::size_t index, std::vector<char*>& local, std::size_t count) {
+	count = (std::min)(count, local.size());
+	std::lock_guard<std::mutex> lock(_depot_mtx[index]);
+	_depot[index].insert(_depot[index].end(), local.end() - count, local.end());
+	local.resize(local.size() - count);
+}
+
+void MsgNodePool::GetStats(uint64_t& alloc_count, uint64_t& malloc_count, uint64_t& oversize_count) {
+	alloc_count = _alloc_count.load(std::memory_order_relaxed);
+	malloc_count = _malloc_count.load(std::memory_order_relaxed);
+	oversize_count = _oversize_count.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,210 @@
+#include "MsgPersist.h"
+#include "ConfigMgr.h"
+#include <chrono>
+
+MsgPersist::MsgPersist() :_batch_size(PERSIST_BATCH_SIZE), _flush_interval_ms(PERSIST_FLUSH_INTERVAL_MS),
+	_max_backlog(PERSIST_MAX_BACKLOG), _b_stop(false), _backlog(0), _rows(0), _flushes(0),
+	_flush_total_us(0), _flush_max_us(0), _rejected(0), _failed(0) {
+	auto& cfg = ConfigMgr::Inst();
+	auto batch_str = cfg.GetValue("MsgPersist", "BatchSize");
+	if (!batch_str.empty() && std::stoi(batch_str) > 0) {
+		_batch_size = std::stoi(batch_str);
+	}
+
+	auto interval_str = cfg.GetValue("MsgPersist", "FlushIntervalMs");
+	if (!interval_str.empty() && std::stoi(interval_str) > 0) {
+		_flush_interval_ms = std::stoi(interval_str);
+	}
+
+	auto backlog_str = cfg.GetValue("MsgPersist", "MaxBacklog");
+	if (!backlog_str.empty() && std::stoi(backlog_str) > 0) {
+		_max_backlog = std::stoi(backlog_str);
+	}
+
+	// 独占一条连接，成组提交不和处理函数的查询抢 MysqlDao 的连接池
+	const auto& host = cfg["Mysql"]["Host"];
+	const auto& port = cfg["Mysql"]["Port"];
+	const auto& pwd = cfg["Mysql"]["Passwd"];
+	const auto& schema = cfg["Mysql"]["Schema"];
+	const auto& user = cfg["Mysql"]["User"];
+	_pool.reset(new MySqlPool(host + ":" + port, user, pwd, schema, 1));
+
+	_buffer.reserve(_batch_size);
+	_thread = std::thread([this]() {
+		Run();
+	});
+	std::cout << "msg persist start, batch size " << _batch_size << ", flush interval "
+		<< _flush_interval_ms << "ms, max backlog " << _max_backlog << std::endl;
+}
+
+MsgPersist::~MsgPersist() {
+	Close();
+}
+
+void MsgPersist::Close() {
+	{
+		std::lock_guard<std::mutex> lock(_mtx);
+		if (_b_stop) {
+			return;
+		}
+		_b_stop = true;
+	}
+	_cond.notify_one();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+	_pool->Close();
+}
+
+bool MsgPersist::Enqueue(std::vector<ChatRecord>&& records) {
+	if (records.empty()) {
+		return true;
+	}
+
+	bool notify = false;
+	{
+		std::lock_guard<std::mutex> lock(_mtx);
+		if (_b_stop || _backlog.load() + records.size() > _max_backlog) {
+			_rejected += records.size();
+			return false;
+		}
+		_backlog += records.size();
+		for (auto& record : records) {
+			_buffer.push_back(std::move(record));
+		}
+		// 攒够一批立即唤醒写线程，否则等时间阈值
+		notify = _buffer.size() >= _batch_size;
+	}
+
+	if (notify) {
+		_cond.notify_one();
+	}
+	return true;
+}
+
+void MsgPersist::Run() {
+	std::vector<ChatRecord> batch;
+	batch.reserve(_batch_size);
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(_mtx);
+			_cond.wait_for(lock, std::chrono::milliseconds(_flush_interval_ms), [this]() {
+				return _b_stop || _buffer.size() >= _batch_size;
+			});
+
+			if (_buffer.empty()) {
+				if (_b_stop) {
+					return;
+				}
+				continue;
+			}
+			// 一次取走全部，写库期间生产者继续往空缓冲区里放
+			batch.swap(_buffer);
+		}
+
+		Flush(batch);
+		batch.clear();
+	}
+}
+
+void MsgPersist::Flush(std::vector<ChatRecord>& batch) {
+	auto start = std::chrono::steady_clock::now();
+	bool success = false;
+	for (int i = 0; i < PERSIST_RETRY_TIMES && !success; ++i) {
+		success = InsertBatch(batch);
+		if (!success) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(_flush_interval_ms));
+		}
+	}
+
+	uint64_t cost_us = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start).count();
+	_flushes++;
+	_flush_total_us += cost_us;
+	if (cost_us > _flush_max_us.load()) {
+		_flush_max_us = cost_us;
+	}
+
+	if (success) {
+		_rows += batch.size();
+	}
+	else {
+		std::cout << "msg persist drop " << batch.size() << " rows after " << PERSIST_RETRY_TIMES
+			<< " retries" << std::endl;
+		_failed += batch.size();
+	}
+	_backlog -= batch.size();
+}
+
+bool MsgPersist::InsertBatch(const std::vector<ChatRecord>& batch) {
+	auto con = _pool->getConnection();
+	if (con == nullptr) {
+		return false;
+	}
+
+	Defer defer([this, &con]() {
+		_pool->returnConnection(std::move(con));
+		});
+
+	try {
+		// 每 _batch_size 行一条多行 INSERT，整批在一个事务里提交
+		con->_con->setAutoCommit(false);
+
+		for (std::size_t begin = 0; begin < batch.size(); begin += _batch_size) {
+			std::size_t rows = (std::min)(_batch_size, batch.size() - begin);
+			std::string sql = "INSERT IGNORE INTO chat_msg (msg_id, from_uid, to_uid, content, send_time) VALUES ";
+			sql.reserve(sql.size() + rows * 32);
+			for (std::size_t i = 0; i < rows; ++i) {
+				sql += i == 0 ? "(?,?,?,?,FROM_UNIXTIME(?/1000))" : ",(?,?,?,?,FROM_UNIXTIME(?/1000))";
+			}
+
+			std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement(sql));
+			int index = 1;
+			for (std::size_t i = begin; i < begin + rows; ++i) {
+				const auto& record = batch[i];
+				pstmt->setString(index++, record.msgid);
+				pstmt->setInt(index++, record.fromuid);
+				pstmt->setInt(index++, record.touid);
+				pstmt->setString(index++, record.content);
+				pstmt->setInt64(index++, record.send_time);
+			}
+			pstmt->executeUpdate();
+		}
+
+		con->_con->commit();
+		con->_con->setAutoCommit(true);
+		auto now = std::chrono::system_clock::now().time_since_epoch();
+		con->_last_oper_time = std::chrono::duration_cast<std::chrono::seconds>(now).count();
+		return true;
+	}
+	catch (sql::SQLException& e) {
+		// 先回滚再恢复自动提交，顺序反过来会把已执行的部分提交掉
+		try {
+			con->_con->rollback();
+			con->_con->setAutoCommit(true);
+		}
+		catch (sql::SQLException&) {
+		}
+		std::cerr << "SQLException: " << e.what();
+		std::cerr << " (MySQL error code: " << e.getErrorCode();
+		std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+		return false;
+	}
+}
+
+PersistStat MsgPersist::GetStats() {
+	PersistStat stat;
+	stat.backlog = _backlog.load();
+	stat.rows = _rows.load();
+	stat.flushes = _flushes.load();
+	stat.flush_total_us = _flush_total_us.load();
+	stat.flush_max_us = _flush_max_us.load();
+	stat.rejected = _rejected.load();
+	stat.failed = _failed.load();
+	return stat;
+}
+
+long long MsgPersist::NowMs() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+}
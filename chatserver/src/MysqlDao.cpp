@@ -401,19 +401,21 @@ bool MysqlDao::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>
 
 
 	try {
-		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("select * from friend where self_id = ? "));
+		// 一次联表取出全部好友资料，不再逐个 GetUser，查询次数与好友数无关
+		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT u.uid, u.name, u.nick, u.`desc`, u.sex, u.icon "
+			"FROM friend f JOIN user u ON u.uid = f.friend_id WHERE f.self_id = ? "));
 
 		pstmt->setInt(1, self_id);
 	
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
-		while (res->next()) {		
-			auto friend_id = res->getInt("friend_id");
-			auto back = res->getString("back");
-			auto user_info = GetUser(friend_id);
-			if (user_info == nullptr) {
-				continue;
-			}
-
+		while (res->next()) {
+			auto user_info = std::make_shared<UserInfo>();
+			user_info->uid = res->getInt("uid");
+			user_info->name = res->getString("name");
+			user_info->nick = res->getString("nick");
+			user_info->desc = res->getString("desc");
+			user_info->sex = res->getInt("sex");
+			user_info->icon = res->getString("icon");
 			user_info->back = user_info->name;
 			user_info_list.push_back(user_info);
 		}
@@ -428,3 +430,169 @@ bool MysqlDao::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>
 
 	return true;
 }
+
+bool MysqlDao::GetUsersAfter(int after_uid, int limit, std::vector<std::shared_ptr<UserInfo> >& users) {
+	auto con = pool_->getConnection();
+	if (con == nullptr) {
+		return false;
+	}
+
+	Defer defer([this, &con]() {
+		pool_->returnConnection(std::move(con));
+		});
+
+	try {
+		// 按主键翻页，每批的代价与已加载的行数无关
+		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT uid, name, nick, `desc`, sex, icon "
+			"FROM user WHERE uid > ? ORDER BY uid LIMIT ?"));
+		pstmt->setInt(1, after_uid);
+		pstmt->setInt(2, limit);
+
+		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		while (res->next()) {
+			auto user_info = std::make_shared<UserInfo>();
+			user_info->uid = res->getInt("uid");
+			user_info->name = res->getString("name");
+			user_info->nick = res->getString("nick");
+			user_info->desc = res->getString("desc");
+			user_info->sex = res->getInt("sex");
+			user_info->icon = res->getString("icon");
+			users.push_back(user_info);
+		}
+		return true;
+	}
+	catch (sql::SQLException& e) {
+		std::cerr << "SQLException: " << e.what();
+		std::cerr << " (MySQL error code: " << e.getErrorCode();
+		std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+		return false;
+	}
+}
+
+bool MysqlDao::GetUserKeysAfter(int after_uid, int limit, std::vector<std::pair<int, std::string> >& keys) {
+	auto con = pool_->getConnection();
+	if (con == nullptr) {
+		return false;
+	}
+
+	Defer defer([this, &con]() {
+		pool_->returnConnection(std::move(con));
+		});
+
+	try {
+		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT uid, name "
+			"FROM user WHERE uid > ? ORDER BY uid LIMIT ?"));
+		pstmt->setInt(1, after_uid);
+		pstmt->setInt(2, limit);
+
+		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		while (res->next()) {
+			keys.emplace_back(res->getInt("uid"), res->getString("name"));
+		}
+		return true;
+	}
+	catch (sql::SQLException& e) {
+		std::cerr << "SQLException: " << e.what();
+		std::cerr << " (MySQL error code: " << e.getErrorCode();
+		std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+		return false;
+	}
+}
+
+long long MysqlDao::AddOfflineMsg(int uid, int msg_id, const std::string& payload, int ttl_sec) {
+	auto con = pool_->getConnection();
+	if (con == nullptr) {
+		return -1;
+	}
+
+	Defer defer([this, &con]() {
+		pool_->returnConnection(std::move(con));
+		});
+
+	try {
+		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("INSERT INTO offline_msg (uid, msg_id, payload, expire_time) "
+			"VALUES (?, ?, ?, DATE_ADD(NOW(), INTERVAL ? SECOND))"));
+		pstmt->setInt(1, uid);
+		pstmt->setInt(2, msg_id);
+		pstmt->setString(3, payload);
+		pstmt->setInt(4, ttl_sec);
+		pstmt->executeUpdate();
+
+		// 同一连接上取刚插入的自增 id
+		std::unique_ptr<sql::Statement> stmt(con->_con->createStatement());
+		std::unique_ptr<sql::ResultSet> res(stmt->executeQuery("SELECT LAST_INSERT_ID() AS id"));
+		if (res->next()) {
+			return res->getInt64("id");
+		}
+		return -1;
+	}
+	catch (sql::SQLException& e) {
+		std::cerr << "SQLException: " << e.what();
+		std::cerr << " (MySQL error code: " << e.getErrorCode();
+		std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+		return -1;
+	}
+}
+
+bool MysqlDao::GetOfflineMsgs(int uid, long long after_id, long long before_id, int limit, std::vector<OfflineMsg>& msgs) {
+	auto con = pool_->getConnection();
+	if (con == nullptr) {
+		return false;
+	}
+
+	Defer defer([this, &con]() {
+		pool_->returnConnection(std::move(con));
+		});
+
+	try {
+		// 依赖 (uid, id) 索引，按 id 分页
+		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT id, msg_id, payload FROM offline_msg "
+			"WHERE uid = ? AND id > ? AND id < ? AND expire_time > NOW() ORDER BY id ASC LIMIT ?"));
+		pstmt->setInt(1, uid);
+		pstmt->setInt64(2, after_id);
+		pstmt->setInt64(3, before_id);
+		pstmt->setInt(4, limit);
+		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		while (res->next()) {
+			OfflineMsg msg;
+			msg.id = res->getInt64("id");
+			msg.msg_id = res->getInt("msg_id");
+			msg.payload = res->getString("payload");
+			msgs.push_back(std::move(msg));
+		}
+		return true;
+	}
+	catch (sql::SQLException& e) {
+		std::cerr << "SQLException: " << e.what();
+		std::cerr << " (MySQL error code: " << e.getErrorCode();
+		std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+		return false;
+	}
+}
+
+bool MysqlDao::DelOfflineMsgs(int uid, long long max_id) {
+	auto con = pool_->getConnection();
+	if (con == nullptr) {
+		return false;
+	}
+
+	Defer defer([this, &con]() {
+		pool_->returnConnection(std::move(con));
+		});
+
+	try {
+		// 已投递的和已过期的一并清理
+		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("DELETE FROM offline_msg "
+			"WHERE uid = ? AND (id <= ? OR expire_time <= NOW())"));
+		pstmt->setInt(1, uid);
+		pstmt->setInt64(2, max_id);
+		pstmt->executeUpdate();
+		return true;
+	}
+	catch (sql::SQLException& e) {
+		std::cerr << "SQLException: " << e.what();
+		std::cerr << " (MySQL error code: " << e.getErrorCode();
+		std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+		return false;
+	}
+}
@@ -58,3 +58,23 @@ bool MysqlMgr::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>
 	return _dao.GetFriendList(self_id, user_info);
 }
 
+bool MysqlMgr::GetUsersAfter(int after_uid, int limit, std::vector<std::shared_ptr<UserInfo> >& users) {
+	return _dao.GetUsersAfter(after_uid, limit, users);
+}
+
+bool MysqlMgr::GetUserKeysAfter(int after_uid, int limit, std::vector<std::pair<int, std::string> >& keys) {
+	return _dao.GetUserKeysAfter(after_uid, limit, keys);
+}
+
+
+long long MysqlMgr::AddOfflineMsg(int uid, int msg_id, const std::string& payload, int ttl_sec) {
+	return _dao.AddOfflineMsg(uid, msg_id, payload, ttl_sec);
+}
+
+bool MysqlMgr::GetOfflineMsgs(int uid, long long after_id, long long before_id, int limit, std::vector<OfflineMsg>& msgs) {
+	return _dao.GetOfflineMsgs(uid, after_id, before_id, limit, msgs);
+}
+
+bool MysqlMgr::DelOfflineMsgs(int uid, long long max_id) {
+	return _dao.DelOfflineMsgs(uid, max_id);
+}
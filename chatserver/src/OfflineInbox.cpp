@@ -0,0 +1,173 @@
+#include "OfflineInbox.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "MysqlMgr.h"
+#include <climits>
+#include <cstdlib>
+
+OfflineInbox::OfflineInbox() :_max_size(OFFLINE_INBOX_MAX_SIZE), _ttl(OFFLINE_INBOX_TTL),
+	_batch_size(OFFLINE_BATCH_SIZE), _pushed(0), _delivered(0) {
+	auto max_size_str = ConfigMgr::Inst().GetValue("OfflineInbox", "MaxSize");
+	if (!max_size_str.empty() && std::stoi(max_size_str) > 0) {
+		_max_size = std::stoi(max_size_str);
+	}
+
+	auto ttl_str = ConfigMgr::Inst().GetValue("OfflineInbox", "TTL");
+	if (!ttl_str.empty() && std::stoi(ttl_str) > 0) {
+		_ttl = std::stoi(ttl_str);
+	}
+
+	auto batch_str = ConfigMgr::Inst().GetValue("OfflineInbox", "BatchSize");
+	if (!batch_str.empty() && std::stoi(batch_str) > 0) {
+		_batch_size = std::stoi(batch_str);
+	}
+}
+
+// 批量帧的头尾，EncodeFrames 和 Push 的长度校验共用
+static const std::string FRAME_HEAD = "{\"error\":0,\"msgs\":[";
+static const std::string FRAME_TAIL = "]}";
+
+// MakeEntry 在消息体外包的字段最多占的字节数（id 按 19 位算）
+static const std::size_t ENTRY_OVERHEAD = 64;
+
+static bool FitsInFrame(std::size_t entry_size) {
+	return FRAME_HEAD.size() + entry_size + FRAME_TAIL.size() <= OFFLINE_FRAME_BYTES;
+}
+
+bool OfflineInbox::Push(int touid, short msg_id, const std::string& json_body) {
+	// 单条放不进一个批量帧的消息补发时发不出去，不存入收件箱
+	if (!FitsInFrame(json_body.size() + ENTRY_OVERHEAD)) {
+		std::cout << "offline msg too large, uid is " << touid << " msg id is " << msg_id
+			<< " size is " << json_body.size() << std::endl;
+		return false;
+	}
+
+	// 先落持久层拿到 id，失败时仍写入热层，只是无法与持久层对齐
+	long long id = MysqlMgr::GetInstance()->AddOfflineMsg(touid, msg_id, json_body, _ttl);
+	if (id < 0) {
+		id = 0;
+	}
+
+	const std::string key = OFFLINE_INBOX_PREFIX + std::to_string(touid);
+	bool success = RedisMgr::GetInstance()->RPushCapped(key, MakeEntry(id, msg_id, json_body), _max_size, _ttl);
+	if (!success && id == 0) {
+		std::cout << "offline inbox push failed, uid is " << touid << " msg id is " << msg_id << std::endl;
+		return false;
+	}
+	_pushed++;
+	return true;
+}
+
+bool OfflineInbox::Fetch(int uid, long long after_id, OfflinePage& page) {
+	page.entries.clear();
+	page.max_id = after_id;
+	page.from_redis = false;
+
+	const std::string key = OFFLINE_INBOX_PREFIX + std::to_string(uid);
+	std::vector<std::string> cached;
+	RedisMgr::GetInstance()->LRange(key, 0, _batch_size - 1, cached);
+
+	// 比热层第一条更早的消息（被长度上限裁掉或热层已过期）先从持久层补发
+	long long head_id = LLONG_MAX;
+	if (!cached.empty()) {
+		head_id = EntryId(cached.front());
+	}
+
+	std::vector<OfflineMsg> rows;
+	if (head_id > after_id + 1) {
+		MysqlMgr::GetInstance()->GetOfflineMsgs(uid, after_id, head_id, _batch_size, rows);
+	}
+	if (!rows.empty()) {
+		for (auto& row : rows) {
+			page.entries.push_back(MakeEntry(row.id, row.msg_id, row.payload));
+			page.max_id = row.id;
+		}
+		return true;
+	}
+
+	page.from_redis = true;
+	for (auto& entry : cached) {
+		auto id = EntryId(entry);
+		if (id > page.max_id) {
+			page.max_id = id;
+		}
+	}
+	page.entries = std::move(cached);
+	return true;
+}
+
+bool OfflineInbox::Ack(int uid, const OfflinePage& page) {
+	if (page.from_redis) {
+		// 补发期间新到的消息追加在尾部，只裁掉已下发的头部
+		const std::string key = OFFLINE_INBOX_PREFIX + std::to_string(uid);
+		if (!RedisMgr::GetInstance()->LTrim(key, static_cast<int>(page.entries.size()), -1)) {
+			return false;
+		}
+	}
+
+	if (!MysqlMgr::GetInstance()->DelOfflineMsgs(uid, page.max_id)) {
+		return false;
+	}
+	_delivered += page.entries.size();
+	return true;
+}
+
+std::vector<std::string> OfflineInbox::EncodeFrames(const OfflinePage& page) {
+	std::vector<std::string> frames;
+	std::string frame;
+	for (auto& entry : page.entries) {
+		// Push 已拒绝过大的消息，这里兜底：单独成帧也超过上限的发不出去，跳过，不能卡住后面的消息
+		if (!FitsInFrame(entry.size())) {
+			std::cout << "offline entry too large, skipped, size is " << entry.size() << std::endl;
+			continue;
+		}
+
+		if (!frame.empty() && frame.size() + entry.size() + 1 + FRAME_TAIL.size() > OFFLINE_FRAME_BYTES) {
+			frame += FRAME_TAIL;
+			frames.push_back(std::move(frame));
+			frame.clear();
+		}
+
+		if (frame.empty()) {
+			frame.reserve(OFFLINE_FRAME_BYTES);
+			frame += FRAME_HEAD;
+		}
+		else {
+			frame += ',';
+		}
+		frame += entry;
+	}
+
+	if (!frame.empty()) {
+		frame += FRAME_TAIL;
+		frames.push_back(std::move(frame));
+	}
+	return frames;
+}
+
+void OfflineInbox::GetStats(uint64_t& pushed, uint64_t& delivered) {
+	pushed = _pushed.load();
+	delivered = _delivered.load();
+}
+
+std::string OfflineInbox::MakeEntry(long long id, short msg_id, const std::string& json_body) {
+	std::string entry;
+	entry.reserve(json_body.size() + 48);
+	entry += "{\"id\":";
+	entry += std::to_string(id);
+	entry += ",\"msgid\":";
+	entry += std::to_string(msg_id);
+	entry += ",\"body\":";
+	entry += json_body;
+	entry += '}';
+	return entry;
+}
+
+long long OfflineInbox::EntryId(const std::string& entry) {
+	// 条目由 MakeEntry 生成，id 固定在开头
+	static const std::string prefix = "{\"id\":";
+	if (entry.compare(0, prefix.size(), prefix) != 0) {
+		return 0;
+	}
+	return std::strtoll(entry.c_str() + prefix.size(), nullptr, 10);
+}
@@ -0,0 +1,128 @@
+#include "OverloadGuard.h"
+#include "ConfigMgr.h"
+#include "LogicSystem.h"
+#include <algorithm>
+#include <iostream>
+
+OverloadGuard::OverloadGuard() :_queue_high_percent(OVERLOAD_QUEUE_HIGH_PERCENT),
+	_queue_wait_high_us(OVERLOAD_QUEUE_WAIT_MS * 1000), _max_connections(OVERLOAD_MAX_CONNECTIONS),
+	_check_interval_ms(OVERLOAD_CHECK_MS), _accept_retry_ms(OVERLOAD_ACCEPT_RETRY_MS),
+	_b_overloaded(false), _b_accept_paused(false), _overload_enters(0), _paused_accepts(0),
+	_shed_search(0), _shed_add_friend(0) {
+	auto& cfg = ConfigMgr::Inst();
+	auto percent_str = cfg.GetValue("Overload", "QueueHighPercent");
+	if (!percent_str.empty() && std::stoi(percent_str) > 0) {
+		_queue_high_percent = std::stoi(percent_str);
+	}
+
+	auto wait_str = cfg.GetValue("Overload", "QueueWaitMs");
+	if (!wait_str.empty() && std::stoi(wait_str) > 0) {
+		_queue_wait_high_us = std::stoll(wait_str) * 1000;
+	}
+
+	auto conn_str = cfg.GetValue("Overload", "MaxConnections");
+	if (!conn_str.empty() && std::stoi(conn_str) > 0) {
+		_max_connections = std::stoi(conn_str);
+	}
+
+	auto check_str = cfg.GetValue("Overload", "CheckIntervalMs");
+	if (!check_str.empty() && std::stoi(check_str) > 0) {
+		_check_interval_ms = std::stoi(check_str);
+	}
+
+	auto retry_str = cfg.GetValue("Overload", "AcceptRetryMs");
+	if (!retry_str.empty() && std::stoi(retry_str) > 0) {
+		_accept_retry_ms = std::stoi(retry_str);
+	}
+}
+
+OverloadGuard::~OverloadGuard() {
+
+}
+
+bool OverloadGuard::Evaluate(std::size_t session_count) {
+	auto logic = LogicSystem::GetInstance();
+	std::size_t max_depth = 0;
+	for (auto depth : logic->GetQueueDepths()) {
+		if (depth > max_depth) {
+			max_depth = depth;
+		}
+	}
+	// 按最忙的 worker 算，消息固定路由，一个 worker 堵住它名下的用户就都慢了
+	std::size_t depth_percent = max_depth * 100 / (std::max)(logic->GetQueueCapacity(), std::size_t(1));
+	int64_t queue_wait_us = logic->GetMaxQueueWaitUs();
+
+	bool was_overloaded = _b_overloaded.load();
+	bool overloaded = was_overloaded;
+	if (!was_overloaded) {
+		overloaded = depth_percent >= _queue_high_percent || queue_wait_us >= _queue_wait_high_us;
+	}
+	else {
+		overloaded = depth_percent >= _queue_high_percent / 2 || queue_wait_us >= _queue_wait_high_us / 2;
+	}
+
+	bool accept_paused = overloaded || session_count >= _max_connections;
+	bool was_paused = _b_accept_paused.exchange(accept_paused);
+	_b_overloaded = overloaded;
+
+	if (overloaded != was_overloaded) {
+		if (overloaded) {
+			_overload_enters++;
+		}
+		std::cout << "overload " << (overloaded ? "enter" : "leave") << ": queue depth " << max_depth
+			<< " (" << depth_percent << "%), queue wait " << queue_wait_us << "us, sessions "
+			<< session_count << endl;
+	}
+	else if (accept_paused != was_paused) {
+		std::cout << "accept " << (accept_paused ? "paused" : "resumed") << ", sessions " << session_count << endl;
+	}
+	return overloaded != was_overloaded;
+}
+
+bool OverloadGuard::Admit(short msg_id) {
+	if (!_b_overloaded.load(std::memory_order_relaxed)) {
+		return true;
+	}
+
+	switch (msg_id) {
+	case ID_SEARCH_USER_REQ:
+		_shed_search++;
+		return false;
+	case ID_ADD_FRIEND_REQ:
+		_shed_add_friend++;
+		return false;
+	default:
+		return true;
+	}
+}
+
+bool OverloadGuard::IsOverloaded() {
+	return _b_overloaded.load(std::memory_order_relaxed);
+}
+
+bool OverloadGuard::AcceptPaused() {
+	return _b_accept_paused.load(std::memory_order_relaxed);
+}
+
+void OverloadGuard::CountPausedAccept() {
+	_paused_accepts++;
+}
+
+int OverloadGuard::GetCheckIntervalMs() {
+	return _check_interval_ms;
+}
+
+int OverloadGuard::GetAcceptRetryMs() {
+	return _accept_retry_ms;
+}
+
+OverloadStat OverloadGuard::GetStats() {
+	OverloadStat stat;
+	stat.b_overloaded = _b_overloaded;
+	stat.b_accept_paused = _b_accept_paused;
+	stat.overload_enters = _overload_enters;
+	stat.paused_accepts = _paused_accepts;
+	stat.shed_search = _shed_search;
+	stat.shed_add_friend = _shed_add_friend;
+	return stat;
+}
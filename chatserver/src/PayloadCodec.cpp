@@ -0,0 +1,218 @@
+#include "PayloadCodec.h"
+#include "FastJson.h"
+#include <cctype>
+
+bool PayloadCodec::IsBinaryLogin(const std::string& data) {
+	for (unsigned char c : data) {
+		if (std::isspace(c)) {
+			continue;
+		}
+		return c != '{';
+	}
+	return true;
+}
+
+bool PayloadCodec::Decode(const std::string& data, bool binary, ChatLoginReq& req) {
+	if (binary) {
+		return req.ParseFromString(data);
+	}
+
+	int uid = 0;
+	if (!FastJson::ParseLogin(data, uid, *req.mutable_token())) {
+		return false;
+	}
+	req.set_uid(uid);
+	return true;
+}
+
+bool PayloadCodec::Decode(const std::string& data, bool binary, TextChatMsgReq& req) {
+	if (binary) {
+		return req.ParseFromString(data);
+	}
+
+	TextChatView view;
+	if (!FastJson::ParseTextChat(data, view)) {
+		return false;
+	}
+	req.set_fromuid(view.fromuid);
+	req.set_touid(view.touid);
+	for (const auto& text : view.texts) {
+		auto* text_msg = req.add_textmsgs();
+		text_msg->set_msgid(text.msgid.data(), text.msgid.size());
+		text_msg->set_msgcontent(text.content.data(), text.content.size());
+	}
+	return true;
+}
+
+bool PayloadCodec::Decode(const std::string& data, bool binary, HeartBeatReq& req) {
+	if (binary) {
+		return req.ParseFromString(data);
+	}
+
+	int fromuid = 0;
+	if (!FastJson::ParseHeartBeat(data, fromuid)) {
+		return false;
+	}
+	req.set_fromuid(fromuid);
+	return true;
+}
+
+std::string PayloadCodec::Encode(const ChatLoginRsp& rsp, bool binary) {
+	if (binary) {
+		return rsp.SerializeAsString();
+	}
+
+	json rtvalue;
+	rtvalue["error"] = rsp.error();
+	if (rsp.error() != ErrorCodes::Success) {
+		return rtvalue.dump();
+	}
+
+	rtvalue["uid"]   = rsp.uid();
+	rtvalue["pwd"]   = rsp.pwd();
+	rtvalue["name"]  = rsp.name();
+	rtvalue["email"] = rsp.email();
+	rtvalue["nick"]  = rsp.nick();
+	rtvalue["desc"]  = rsp.desc();
+	rtvalue["sex"]   = rsp.sex();
+	rtvalue["icon"]  = rsp.icon();
+
+	if (rsp.apply_list_size() > 0) {
+		json apply_arr = json::array();
+		for (const auto& apply : rsp.apply_list()) {
+			apply_arr.push_back({
+				{"name",   apply.name()},
+				{"uid",    apply.uid()},
+				{"icon",   apply.icon()},
+				{"nick",   apply.nick()},
+				{"sex",    apply.sex()},
+				{"desc",   apply.desc()},
+				{"status", apply.status()}
+			});
+		}
+		rtvalue["apply_list"] = std::move(apply_arr);
+	}
+
+	if (rsp.friend_list_size() > 0) {
+		json friend_arr = json::array();
+		for (const auto& f : rsp.friend_list()) {
+			friend_arr.push_back({
+				{"name",  f.name()},
+				{"uid",   f.uid()},
+				{"icon",  f.icon()},
+				{"nick",  f.nick()},
+				{"sex",   f.sex()},
+				{"desc",  f.desc()},
+				{"back",  f.back()}
+			});
+		}
+		rtvalue["friend_list"] = std::move(friend_arr);
+	}
+	return rtvalue.dump();
+}
+
+std::string PayloadCodec::Encode(const TextChatMsgRsp& rsp, bool binary) {
+	if (binary) {
+		return rsp.SerializeAsString();
+	}
+
+	json text_array = json::array();
+	for (const auto& msg : rsp.textmsgs()) {
+		text_array.push_back({
+			{"content", msg.msgcontent()},
+			{"msgid",   msg.msgid()}
+		});
+	}
+
+	json rtvalue = {
+		{"error",   rsp.error()},
+		{"fromuid", rsp.fromuid()},
+		{"touid",   rsp.touid()},
+	};
+	rtvalue["text_array"] = std::move(text_array);
+	return rtvalue.dump();
+}
+
+std::string PayloadCodec::Encode(const AddFriendNotify& notify, bool binary) {
+	if (binary) {
+		return notify.SerializeAsString();
+	}
+
+	json rtvalue = {
+		{"error",    notify.error()},
+		{"applyuid", notify.applyuid()},
+		{"name",     notify.name()},
+		{"desc",     notify.desc()},
+		{"icon",     notify.icon()},
+		{"sex",      notify.sex()},
+		{"nick",     notify.nick()},
+	};
+	return rtvalue.dump();
+}
+
+std::string PayloadCodec::Encode(const AuthFriendNotify& notify, bool binary) {
+	if (binary) {
+		return notify.SerializeAsString();
+	}
+
+	json rtvalue = {
+		{"error",   notify.error()},
+		{"fromuid", notify.fromuid()},
+		{"touid",   notify.touid()},
+	};
+	if (notify.error() == ErrorCodes::Success) {
+		rtvalue["name"] = notify.name();
+		rtvalue["nick"] = notify.nick();
+		rtvalue["icon"] = notify.icon();
+		rtvalue["sex"]  = notify.sex();
+	}
+	return rtvalue.dump();
+}
+
+std::string PayloadCodec::Encode(const KickUserRsp& notify, bool binary) {
+	if (binary) {
+		return notify.SerializeAsString();
+	}
+
+	json rtvalue = {
+		{"error", notify.error()},
+		{"uid",   notify.uid()}
+	};
+	return rtvalue.dump();
+}
+
+std::string PayloadCodec::Encode(const HeartBeatRsp& rsp, bool binary) {
+	if (binary) {
+		return rsp.SerializeAsString();
+	}
+
+	json rtvalue = {
+		{"error", rsp.error()}
+	};
+	return rtvalue.dump();
+}
+
+std::string PayloadCodec::EncodeError(int error, bool binary) {
+	HeartBeatRsp rsp;
+	rsp.set_error(error);
+	return Encode(rsp, binary);
+}
+
+std::string PayloadCodec::WithError(const std::string& json_obj, int error) {
+	std::size_t brace = json_obj.find('{');
+	if (brace == std::string::npos) {
+		return EncodeError(error, false);
+	}
+	std::string head = "{\"error\":" + std::to_string(error);
+	std::string out;
+	out.reserve(head.size() + json_obj.size() + 1 + JSON_PADDING);
+	out.append(head);
+
+	// 空对象不能补逗号
+	std::size_t body = json_obj.find_first_not_of(" \t\r\n", brace + 1);
+	if (body != std::string::npos && json_obj[body] != '}') {
+		out.push_back(',');
+	}
+	out.append(json_obj, brace + 1, std::string::npos);
+	return out;
+}
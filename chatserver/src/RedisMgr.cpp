@@ -2,12 +2,37 @@
 #include "const.h"
 #include "ConfigMgr.h"
 #include "DistLock.h"
-RedisMgr::RedisMgr() {
+RedisMgr::RedisMgr() :_port(0), _b_sub_stop(false) {
 	auto& gCfgMgr = ConfigMgr::Inst();
 	auto host = gCfgMgr["Redis"]["Host"];
 	auto port = gCfgMgr["Redis"]["Port"];
 	auto pwd = gCfgMgr["Redis"]["Passwd"];
-	_con_pool.reset(new RedisConPool(10, host.c_str(), atoi(port.c_str()), pwd.c_str()));
+	_host = host;
+	_port = atoi(port.c_str());
+	_pwd = pwd;
+	_con_pool.reset(new RedisConPool(GetPoolSize(), host.c_str(), atoi(port.c_str()), pwd.c_str()));
+}
+
+//  Redis Ҫ I/O ̳߳غ߼ workerÿ߳õһ
+std::size_t RedisMgr::GetPoolSize() {
+	auto& cfg = ConfigMgr::Inst();
+	auto pool_str = cfg.GetValue("Redis", "PoolSize");
+	if (!pool_str.empty() && std::stoi(pool_str) > 0) {
+		return std::stoi(pool_str);
+	}
+
+	std::size_t io_threads = LOGIC_IO_THREAD_COUNT;
+	auto io_threads_str = cfg.GetValue("LogicSystem", "IoThreads");
+	if (!io_threads_str.empty() && std::stoi(io_threads_str) > 0) {
+		io_threads = std::stoi(io_threads_str);
+	}
+
+	std::size_t workers = LOGIC_WORKER_COUNT;
+	auto workers_str = cfg.GetValue("LogicSystem", "Workers");
+	if (!workers_str.empty() && std::stoi(workers_str) > 0) {
+		workers = std::stoi(workers_str);
+	}
+	return io_threads + workers + REDIS_POOL_EXTRA;
 }
 
 RedisMgr::~RedisMgr() {
@@ -183,6 +208,285 @@ bool RedisMgr::RPop(const std::string& key, std::string& value) {
 	return true;
 }
 
+bool RedisMgr::RPushCapped(const std::string& key, const std::string& value, int max_len, int ttl_sec) {
+	std::vector<RedisValue> replies;
+	bool success = Pipeline({
+		{ "RPUSH", key, value },
+		{ "LTRIM", key, std::to_string(-max_len), "-1" },
+		{ "EXPIRE", key, std::to_string(ttl_sec) },
+		}, replies);
+	if (!success) {
+		std::cout << "Execut command [ RPUSH " << key << " ] pipeline failure ! " << std::endl;
+		return false;
+	}
+
+	for (auto& reply : replies) {
+		if (reply.IsError()) {
+			std::cout << "Execut command [ RPUSH " << key << " ] failure, " << reply.str << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool RedisMgr::LRange(const std::string& key, int start, int stop, std::vector<std::string>& values) {
+	auto connect = _con_pool->getConnection();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "LRANGE %s %d %d", key.c_str(), start, stop);
+	if (reply == nullptr) {
+		std::cout << "Execut command [ LRANGE " << key << " ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_ARRAY) {
+		std::cout << "Execut command [ LRANGE " << key << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	values.reserve(values.size() + reply->elements);
+	for (size_t i = 0; i < reply->elements; ++i) {
+		auto* element = reply->element[i];
+		if (element->type == REDIS_REPLY_STRING) {
+			values.emplace_back(element->str, element->len);
+		}
+	}
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+bool RedisMgr::LTrim(const std::string& key, int start, int stop) {
+	auto connect = _con_pool->getConnection();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "LTRIM %s %d %d", key.c_str(), start, stop);
+	if (reply == nullptr) {
+		std::cout << "Execut command [ LTRIM " << key << " ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type == REDIS_REPLY_ERROR) {
+		std::cout << "Execut command [ LTRIM " << key << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+static void CopyReply(const redisReply* reply, RedisValue& value) {
+	value.type = reply->type;
+	switch (reply->type) {
+	case REDIS_REPLY_INTEGER:
+		value.integer = reply->integer;
+		break;
+	case REDIS_REPLY_STRING:
+	case REDIS_REPLY_STATUS:
+	case REDIS_REPLY_ERROR:
+		value.str.assign(reply->str, reply->len);
+		break;
+	case REDIS_REPLY_ARRAY:
+		value.elements.resize(reply->elements);
+		for (size_t i = 0; i < reply->elements; ++i) {
+			CopyReply(reply->element[i], value.elements[i]);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+bool RedisMgr::Pipeline(const std::vector<std::vector<std::string>>& cmds, std::vector<RedisValue>& replies) {
+	auto connect = _con_pool->getConnection();
+	if (connect == nullptr) {
+		return false;
+	}
+	Defer defer([this, connect]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	std::vector<const char*> argv;
+	std::vector<size_t> argvlen;
+	for (auto& cmd : cmds) {
+		argv.clear();
+		argvlen.clear();
+		for (auto& arg : cmd) {
+			argv.push_back(arg.data());
+			argvlen.push_back(arg.size());
+		}
+		if (redisAppendCommandArgv(connect, static_cast<int>(argv.size()), argv.data(), argvlen.data()) != REDIS_OK) {
+			std::cout << "Execut pipeline failure, error is " << connect->errstr << std::endl;
+			return false;
+		}
+	}
+
+	// дȫأӦλһʹøӵĵ
+	replies.clear();
+	replies.resize(cmds.size());
+	for (size_t i = 0; i < cmds.size(); ++i) {
+		redisReply* reply = nullptr;
+		if (redisGetReply(connect, (void**)&reply) != REDIS_OK || reply == nullptr) {
+			std::cout << "Execut pipeline failure, error is " << connect->errstr << std::endl;
+			return false;
+		}
+		CopyReply(reply, replies[i]);
+		freeReplyObject(reply);
+	}
+	return true;
+}
+
+bool RedisMgr::EvalScript(const std::string& script, const std::vector<std::string>& keys,
+	const std::vector<std::string>& args, RedisValue& reply) {
+	std::string sha;
+	{
+		std::lock_guard<std::mutex> lock(_script_mtx);
+		auto iter = _script_shas.find(script);
+		if (iter != _script_shas.end()) {
+			sha = iter->second;
+		}
+	}
+
+	std::vector<RedisValue> replies;
+	if (sha.empty()) {
+		if (!Pipeline({ { "SCRIPT", "LOAD", script } }, replies) || replies[0].type != REDIS_REPLY_STRING) {
+			std::cout << "Execut command [ SCRIPT LOAD ] failure ! " << std::endl;
+			return false;
+		}
+		sha = replies[0].str;
+		std::lock_guard<std::mutex> lock(_script_mtx);
+		_script_shas[script] = sha;
+	}
+
+	std::vector<std::string> cmd = { "EVALSHA", sha, std::to_string(keys.size()) };
+	cmd.insert(cmd.end(), keys.begin(), keys.end());
+	cmd.insert(cmd.end(), args.begin(), args.end());
+	if (!Pipeline({ cmd }, replies)) {
+		return false;
+	}
+
+	// Redis ű涪ʧ EVAL ִһΣ˻˳»
+	if (replies[0].IsError() && replies[0].str.compare(0, 8, "NOSCRIPT") == 0) {
+		cmd[0] = "EVAL";
+		cmd[1] = script;
+		if (!Pipeline({ cmd }, replies)) {
+			return false;
+		}
+	}
+
+	if (replies[0].IsError()) {
+		std::cout << "Execut script failure, error is " << replies[0].str << std::endl;
+		return false;
+	}
+	reply = std::move(replies[0]);
+	return true;
+}
+
+// KEYS: utoken_ uip_ usession_ ubaseinfo_   ARGV: token server_name session_id
+//  {error, ɷ, ɻỰ id, Ϣ}ڵΪ nil
+static const std::string LOGIN_BIND_SCRIPT = R"(
+local token = redis.call('GET', KEYS[1])
+if not token then
+	return {1}
+end
+if token ~= ARGV[1] then
+	return {2}
+end
+local old_server = redis.call('GET', KEYS[2])
+local old_session = redis.call('GET', KEYS[3])
+redis.call('SET', KEYS[2], ARGV[2])
+redis.call('SET', KEYS[3], ARGV[3])
+return {0, old_server, old_session, redis.call('GET', KEYS[4])}
+)";
+
+bool RedisMgr::LoginBind(int uid, const std::string& token, const std::string& server_name,
+	const std::string& session_id, LoginBindResult& result) {
+	const std::string uid_str = std::to_string(uid);
+	RedisValue reply;
+	bool success = EvalScript(LOGIN_BIND_SCRIPT,
+		{ USERTOKENPREFIX + uid_str, USERIPPREFIX + uid_str, USER_SESSION_PREFIX + uid_str, USER_BASE_INFO + uid_str },
+		{ token, server_name, session_id }, reply);
+	if (!success || reply.type != REDIS_REPLY_ARRAY || reply.elements.empty()) {
+		return false;
+	}
+
+	auto& items = reply.elements;
+	switch (items[0].integer) {
+	case 0:
+		result.error = ErrorCodes::Success;
+		break;
+	case 2:
+		result.error = ErrorCodes::TokenInvalid;
+		return true;
+	default:
+		result.error = ErrorCodes::UidInvalid;
+		return true;
+	}
+
+	// Lua  false ת nil鳤ȹ̶Ϊ 4
+	if (items.size() > 2 && !items[1].IsNil()) {
+		result.b_old = true;
+		result.old_server = items[1].str;
+		result.old_session = items[2].str;
+	}
+	if (items.size() > 3 && !items[3].IsNil()) {
+		result.b_base = true;
+		result.base_info = items[3].str;
+	}
+	return true;
+}
+
+// KEYS: uip_ usession_   ARGV: session_id old_server old_sessionold_server Ϊձʾǰûе¼
+static const std::string ROLLBACK_BIND_SCRIPT = R"(
+if redis.call('GET', KEYS[2]) ~= ARGV[1] then
+	return 0
+end
+if ARGV[2] == '' then
+	redis.call('DEL', KEYS[1], KEYS[2])
+else
+	redis.call('SET', KEYS[1], ARGV[2])
+	redis.call('SET', KEYS[2], ARGV[3])
+end
+return 1
+)";
+
+bool RedisMgr::RollbackBind(int uid, const std::string& session_id, const LoginBindResult& bind) {
+	const std::string uid_str = std::to_string(uid);
+	RedisValue reply;
+	if (!EvalScript(ROLLBACK_BIND_SCRIPT, { USERIPPREFIX + uid_str, USER_SESSION_PREFIX + uid_str },
+		{ session_id, bind.b_old ? bind.old_server : "", bind.old_session }, reply)) {
+		return false;
+	}
+	return reply.type == REDIS_REPLY_INTEGER && reply.integer > 0;
+}
+
+// KEYS: usession_ uip_   ARGV: session_id
+static const std::string UNBIND_SESSION_SCRIPT = R"(
+if redis.call('GET', KEYS[1]) == ARGV[1] then
+	return redis.call('DEL', KEYS[1], KEYS[2])
+end
+return 0
+)";
+
+bool RedisMgr::UnbindSession(int uid, const std::string& session_id) {
+	const std::string uid_str = std::to_string(uid);
+	RedisValue reply;
+	if (!EvalScript(UNBIND_SESSION_SCRIPT, { USER_SESSION_PREFIX + uid_str, USERIPPREFIX + uid_str },
+		{ session_id }, reply)) {
+		return false;
+	}
+	return reply.type == REDIS_REPLY_INTEGER && reply.integer > 0;
+}
+
 bool RedisMgr::HSet(const std::string &key, const std::string &hkey, const std::string &value) {
 	auto connect = _con_pool->getConnection();
 	if (connect == nullptr) {
@@ -459,3 +763,86 @@ void RedisMgr::DelCount(std::string server_name) {
 
 	RedisMgr::GetInstance()->HDel(LOGIN_COUNT, server_name);
 }
+
+redisContext* RedisMgr::ConnectSubscriber(const std::string& channel) {
+	auto* context = redisConnect(_host.c_str(), _port);
+	if (context == nullptr || context->err != 0) {
+		if (context != nullptr) {
+			redisFree(context);
+		}
+		return nullptr;
+	}
+
+	auto reply = (redisReply*)redisCommand(context, "AUTH %s", _pwd.c_str());
+	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR) {
+		std::cout << "subscriber auth failed" << std::endl;
+		if (reply != nullptr) {
+			freeReplyObject(reply);
+		}
+		redisFree(context);
+		return nullptr;
+	}
+	freeReplyObject(reply);
+
+	reply = (redisReply*)redisCommand(context, "SUBSCRIBE %b", channel.data(), channel.size());
+	if (reply == nullptr || reply->type != REDIS_REPLY_ARRAY) {
+		std::cout << "Execut command [ SUBSCRIBE " << channel << " ] failure ! " << std::endl;
+		if (reply != nullptr) {
+			freeReplyObject(reply);
+		}
+		redisFree(context);
+		return nullptr;
+	}
+	freeReplyObject(reply);
+	std::cout << "Execut command [ SUBSCRIBE " << channel << " ] success ! " << std::endl;
+	return context;
+}
+
+void RedisMgr::Subscribe(const std::string& channel, std::function<void(const std::string&)> on_message,
+	std::function<void()> on_connect) {
+	std::lock_guard<std::mutex> lock(_sub_mtx);
+	_sub_channels.push_back(channel);
+	_sub_threads.emplace_back([this, channel, on_message, on_connect]() {
+		while (!_b_sub_stop) {
+			auto* context = ConnectSubscriber(channel);
+			if (context == nullptr) {
+				std::this_thread::sleep_for(std::chrono::seconds(1));
+				continue;
+			}
+			on_connect();
+
+			// ֻյͣߣ¶
+			while (!_b_sub_stop) {
+				redisReply* reply = nullptr;
+				if (redisGetReply(context, (void**)&reply) != REDIS_OK || reply == nullptr) {
+					std::cout << "subscriber on " << channel << " disconnected, error is " << context->errstr << std::endl;
+					break;
+				}
+				// ͸ʽΪ ["message", channel, payload]
+				if (reply->type == REDIS_REPLY_ARRAY && reply->elements == 3 &&
+					reply->element[2]->type == REDIS_REPLY_STRING && !_b_sub_stop) {
+					on_message(std::string(reply->element[2]->str, reply->element[2]->len));
+				}
+				freeReplyObject(reply);
+			}
+			redisFree(context);
+		}
+	});
+}
+
+// ߳ڶϣƵһϢǻѺٵȴ˳
+void RedisMgr::StopSubscribers() {
+	std::lock_guard<std::mutex> lock(_sub_mtx);
+	_b_sub_stop = true;
+	std::vector<RedisValue> replies;
+	for (auto& channel : _sub_channels) {
+		Pipeline({ { "PUBLISH", channel, "" } }, replies);
+	}
+	for (auto& thread : _sub_threads) {
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+	_sub_threads.clear();
+}
+
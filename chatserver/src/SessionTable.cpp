@@ -0,0 +1,43 @@
+#include "SessionTable.h"
+#include "CSession.h"
+
+SessionTable::Shard& SessionTable::GetShard(const std::string& session_id) {
+	return _shards[std::hash<std::string>()(session_id) % SESSION_SHARD_COUNT];
+}
+
+void SessionTable::Insert(const std::string& session_id, std::shared_ptr<CSession> session) {
+	auto& shard = GetShard(session_id);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	shard._sessions[session_id] = std::move(session);
+}
+
+std::shared_ptr<CSession> SessionTable::Erase(const std::string& session_id) {
+	auto& shard = GetShard(session_id);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._sessions.find(session_id);
+	if (iter == shard._sessions.end()) {
+		return nullptr;
+	}
+	auto session = std::move(iter->second);
+	shard._sessions.erase(iter);
+	return session;
+}
+
+std::shared_ptr<CSession> SessionTable::Find(const std::string& session_id) {
+	auto& shard = GetShard(session_id);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._sessions.find(session_id);
+	if (iter == shard._sessions.end()) {
+		return nullptr;
+	}
+	return iter->second;
+}
+
+std::size_t SessionTable::Size() {
+	std::size_t total = 0;
+	for (auto& shard : _shards) {
+		std::lock_guard<std::mutex> lock(shard._mutex);
+		total += shard._sessions.size();
+	}
+	return total;
+}
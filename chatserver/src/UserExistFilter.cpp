@@ -0,0 +1,264 @@
+#include "UserExistFilter.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "MysqlMgr.h"
+#include <algorithm>
+#include <iostream>
+
+UserExistFilter::UserExistFilter() :_fp_rate(USER_FILTER_FP_RATE), _rebuild_sec(USER_FILTER_REBUILD_SEC),
+	_b_rebuilding(false), _b_stop(false), _b_rebuild_now(false), _rebuilds(0), _checks(0), _rejected(0),
+	_false_positives(0) {
+	auto& cfg = ConfigMgr::Inst();
+	auto fp_str = cfg.GetValue("UserFilter", "FalsePositiveRate");
+	if (!fp_str.empty() && std::stod(fp_str) > 0 && std::stod(fp_str) < 1) {
+		_fp_rate = std::stod(fp_str);
+	}
+
+	auto rebuild_str = cfg.GetValue("UserFilter", "RebuildSec");
+	if (!rebuild_str.empty() && std::stoi(rebuild_str) > 0) {
+		_rebuild_sec = std::stoi(rebuild_str);
+	}
+}
+
+UserExistFilter::~UserExistFilter() {
+	Stop();
+}
+
+void UserExistFilter::Start() {
+	RedisMgr::GetInstance()->Subscribe(USER_PROFILE_CHANNEL,
+		[this](const std::string& message) {
+			OnProfileChanged(message);
+		},
+		[this]() {
+			// 断线期间可能漏掉了注册广播，重建一次
+			{
+				std::lock_guard<std::mutex> lock(_rebuild_mtx);
+				_b_rebuild_now = true;
+			}
+			_rebuild_cond.notify_one();
+		});
+
+	_rebuilder = std::thread([this]() {
+		RebuildLoop();
+	});
+}
+
+void UserExistFilter::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(_rebuild_mtx);
+		_b_stop = true;
+	}
+	_rebuild_cond.notify_all();
+	if (_rebuilder.joinable()) {
+		_rebuilder.join();
+	}
+}
+
+// MySQL 的默认排序规则不区分大小写、忽略末尾空格，这里按同样规则归一；
+// 非 ASCII 的名字还涉及重音等规则，不参与判定
+bool UserExistFilter::NameKey(const std::string& name, std::string& key) {
+	key = name;
+	while (!key.empty() && key.back() == ' ') {
+		key.pop_back();
+	}
+	for (auto& c : key) {
+		if (static_cast<unsigned char>(c) >= 0x80) {
+			return false;
+		}
+		if (c >= 'A' && c <= 'Z') {
+			c = c - 'A' + 'a';
+		}
+	}
+	return true;
+}
+
+// 含汉字、假名或谚文的名字在任何排序规则下都不会等于纯 ASCII 的名字，其余非 ASCII 字符
+// （带重音的拉丁字母、全角字母等）可能被折叠成 ASCII，保守地认为可能相等
+bool UserExistFilter::MayEqualAscii(const std::string& name) {
+	std::size_t i = 0;
+	while (i < name.size()) {
+		unsigned char c = name[i];
+		int len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 1;
+		if (i + len > name.size()) {
+			len = 1;
+		}
+		uint32_t cp = len == 1 ? c : c & (0x7F >> len);
+		for (int k = 1; k < len; ++k) {
+			cp = (cp << 6) | (static_cast<unsigned char>(name[i + k]) & 0x3F);
+		}
+		if ((cp >= 0x3040 && cp <= 0x30FF) || (cp >= 0x3400 && cp <= 0x4DBF) || (cp >= 0x4E00 && cp <= 0x9FFF) ||
+			(cp >= 0xAC00 && cp <= 0xD7AF) || (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x20000 && cp <= 0x3FFFF)) {
+			return false;
+		}
+		i += len;
+	}
+	return true;
+}
+
+void UserExistFilter::AddKey(Filters& filters, int uid, const std::string& name) {
+	filters.uids.Add(BloomFilter::Hash(static_cast<uint64_t>(uid)));
+	std::string key;
+	if (NameKey(name, key)) {
+		filters.names.Add(BloomFilter::Hash(key));
+	}
+	else if (filters.b_name_check && MayEqualAscii(name)) {
+		filters.b_name_check = false;
+		std::cout << "user exist filter: name " << name << " may match ASCII names, name check disabled" << std::endl;
+	}
+}
+
+void UserExistFilter::RebuildLoop() {
+	while (!_b_stop) {
+		// 本次重建已覆盖此前的断线重连
+		{
+			std::lock_guard<std::mutex> lock(_rebuild_mtx);
+			_b_rebuild_now = false;
+		}
+		if (Rebuild()) {
+			_rebuilds++;
+		}
+
+		std::unique_lock<std::mutex> lock(_rebuild_mtx);
+		_rebuild_cond.wait_for(lock, std::chrono::seconds(_rebuild_sec), [this]() {
+			return _b_stop || _b_rebuild_now;
+		});
+	}
+}
+
+bool UserExistFilter::Rebuild() {
+	{
+		std::lock_guard<std::mutex> lock(_pending_mtx);
+		_b_rebuilding = true;
+		_pending.clear();
+	}
+
+	std::vector<std::pair<int, std::string> > keys;
+	bool success = true;
+	while (!_b_stop) {
+		int after_uid = keys.empty() ? 0 : keys.back().first;
+		auto size = keys.size();
+		if (!MysqlMgr::GetInstance()->GetUserKeysAfter(after_uid, USER_FILTER_LOAD_BATCH, keys)) {
+			success = false;
+			break;
+		}
+		if (keys.size() - size < USER_FILTER_LOAD_BATCH) {
+			break;
+		}
+	}
+
+	if (!success || _b_stop) {
+		std::lock_guard<std::mutex> lock(_pending_mtx);
+		_b_rebuilding = false;
+		_pending.clear();
+		return false;
+	}
+
+	// 留出到下次重建前新注册用户的余量
+	auto filters = std::make_shared<Filters>(keys.size() + keys.size() / 4 + 1024, _fp_rate);
+	for (auto& key : keys) {
+		AddKey(*filters, key.first, key.second);
+	}
+	filters->max_uid = keys.empty() ? 0 : keys.back().first;
+
+	{
+		std::lock_guard<std::mutex> lock(_pending_mtx);
+		for (auto& key : _pending) {
+			AddKey(*filters, key.first, key.second);
+		}
+		_pending.clear();
+		_b_rebuilding = false;
+		std::atomic_store(&_filters, filters);
+	}
+
+	std::cout << "user exist filter rebuilt, " << keys.size() << " users, max uid " << filters->max_uid
+		<< ", " << (filters->uids.GetMemoryBytes() + filters->names.GetMemoryBytes()) / 1024 << " KiB"
+		<< ", name check " << (filters->b_name_check ? "on" : "off") << std::endl;
+	return true;
+}
+
+void UserExistFilter::OnProfileChanged(const std::string& message) {
+	auto pos = message.find('|');
+	if (pos == std::string::npos) {
+		return;
+	}
+
+	int uid = 0;
+	try {
+		uid = std::stoi(message.substr(0, pos));
+	}
+	catch (std::exception& e) {
+		std::cout << "user profile message " << message << " invalid: " << e.what() << std::endl;
+		return;
+	}
+	auto name = message.substr(pos + 1);
+
+	std::lock_guard<std::mutex> lock(_pending_mtx);
+	auto filters = std::atomic_load(&_filters);
+	if (filters) {
+		AddKey(*filters, uid, name);
+	}
+	if (_b_rebuilding) {
+		_pending.emplace_back(uid, name);
+	}
+}
+
+bool UserExistFilter::MayHaveUid(int uid) {
+	auto filters = std::atomic_load(&_filters);
+	if (!filters || uid > filters->max_uid) {
+		return true;
+	}
+
+	_checks++;
+	if (filters->uids.MayContain(BloomFilter::Hash(static_cast<uint64_t>(uid)))) {
+		return true;
+	}
+	_rejected++;
+	return false;
+}
+
+bool UserExistFilter::MayHaveName(const std::string& name) {
+	auto filters = std::atomic_load(&_filters);
+	std::string key;
+	if (!filters || !filters->b_name_check || !NameKey(name, key)) {
+		return true;
+	}
+
+	_checks++;
+	if (filters->names.MayContain(BloomFilter::Hash(key))) {
+		return true;
+	}
+	_rejected++;
+	return false;
+}
+
+void UserExistFilter::CountFalsePositive(int uid) {
+	auto filters = std::atomic_load(&_filters);
+	if (filters && uid <= filters->max_uid) {
+		_false_positives++;
+	}
+}
+
+void UserExistFilter::CountFalsePositive(const std::string& name) {
+	auto filters = std::atomic_load(&_filters);
+	std::string key;
+	if (filters && filters->b_name_check && NameKey(name, key)) {
+		_false_positives++;
+	}
+}
+
+UserFilterStat UserExistFilter::GetStats() {
+	UserFilterStat stat;
+	auto filters = std::atomic_load(&_filters);
+	if (filters) {
+		stat.b_ready = true;
+		stat.users = filters->uids.GetCount();
+		stat.max_uid = filters->max_uid;
+		stat.memory_bytes = filters->uids.GetMemoryBytes() + filters->names.GetMemoryBytes();
+		stat.estimated_fp_rate = (std::max)(filters->uids.EstimatedFpRate(), filters->names.EstimatedFpRate());
+	}
+	stat.rebuilds = _rebuilds;
+	stat.checks = _checks;
+	stat.rejected = _rejected;
+	stat.false_positives = _false_positives;
+	return stat;
+}
@@ -0,0 +1,247 @@
+#include "UserInfoCache.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "MysqlMgr.h"
+#include "UserExistFilter.h"
+#include <nlohmann/json.hpp>
+#include <iostream>
+
+using json = nlohmann::json;
+
+UserInfoCache::UserInfoCache() :_shard_capacity(USER_CACHE_CAPACITY / USER_CACHE_SHARDS),
+	_ttl(USER_CACHE_TTL), _negative_ttl(USER_CACHE_NEGATIVE_TTL), _hits(0), _negative_hits(0),
+	_misses(0), _redis_hits(0), _db_loads(0), _invalidations(0) {
+	auto& cfg = ConfigMgr::Inst();
+	auto capacity_str = cfg.GetValue("UserCache", "Capacity");
+	if (!capacity_str.empty() && std::stoi(capacity_str) > 0) {
+		_shard_capacity = std::stoi(capacity_str) / USER_CACHE_SHARDS;
+	}
+	if (_shard_capacity == 0) {
+		_shard_capacity = 1;
+	}
+
+	auto ttl_str = cfg.GetValue("UserCache", "TTL");
+	if (!ttl_str.empty() && std::stoi(ttl_str) > 0) {
+		_ttl = std::chrono::seconds(std::stoi(ttl_str));
+	}
+
+	auto negative_str = cfg.GetValue("UserCache", "NegativeTTL");
+	if (!negative_str.empty() && std::stoi(negative_str) > 0) {
+		_negative_ttl = std::chrono::seconds(std::stoi(negative_str));
+	}
+
+	_self_name = cfg["SelfServer"]["Name"];
+	RedisMgr::GetInstance()->Subscribe(USER_CACHE_CHANNEL,
+		[this](const std::string& message) {
+			OnInvalidate(message);
+		},
+		[this]() {
+			// 断线期间可能漏掉了失效广播，已缓存的条目都不可信
+			Clear();
+		});
+}
+
+UserInfoCache::~UserInfoCache() {
+
+}
+
+UserInfoCache::Shard& UserInfoCache::GetShard(int uid) {
+	return _shards[static_cast<unsigned int>(uid) % USER_CACHE_SHARDS];
+}
+
+bool UserInfoCache::Lookup(int uid, std::shared_ptr<UserInfo>& userinfo) {
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard.mtx);
+	auto iter = shard.entries.find(uid);
+	if (iter == shard.entries.end()) {
+		return false;
+	}
+
+	if (iter->second.expire <= std::chrono::steady_clock::now()) {
+		shard.lru.erase(iter->second.lru_iter);
+		shard.entries.erase(iter);
+		return false;
+	}
+
+	shard.lru.splice(shard.lru.begin(), shard.lru, iter->second.lru_iter);
+	userinfo = iter->second.info;
+	return true;
+}
+
+void UserInfoCache::Insert(int uid, std::shared_ptr<UserInfo> userinfo) {
+	auto expire = std::chrono::steady_clock::now() + (userinfo ? _ttl : _negative_ttl);
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard.mtx);
+	auto iter = shard.entries.find(uid);
+	if (iter != shard.entries.end()) {
+		iter->second.info = std::move(userinfo);
+		iter->second.expire = expire;
+		shard.lru.splice(shard.lru.begin(), shard.lru, iter->second.lru_iter);
+		return;
+	}
+
+	if (shard.entries.size() >= _shard_capacity) {
+		shard.entries.erase(shard.lru.back());
+		shard.lru.pop_back();
+	}
+
+	shard.lru.push_front(uid);
+	Entry entry;
+	entry.info = std::move(userinfo);
+	entry.expire = expire;
+	entry.lru_iter = shard.lru.begin();
+	shard.entries.emplace(uid, std::move(entry));
+}
+
+bool UserInfoCache::Get(int uid, std::shared_ptr<UserInfo>& userinfo) {
+	std::shared_ptr<UserInfo> cached;
+	if (Lookup(uid, cached)) {
+		if (!cached) {
+			_negative_hits++;
+			return false;
+		}
+		_hits++;
+		userinfo = cached;
+		return true;
+	}
+	_misses++;
+
+	// 过滤器判定不存在的 uid 不查 Redis 和 MySQL
+	if (!UserExistFilter::GetInstance()->MayHaveUid(uid)) {
+		return false;
+	}
+
+	auto loaded = _loads.Do(uid, [this, uid]() {
+		return Load(uid);
+	});
+	if (!loaded) {
+		return false;
+	}
+	userinfo = loaded;
+	return true;
+}
+
+std::shared_ptr<UserInfo> UserInfoCache::Load(int uid) {
+	std::string base_key = USER_BASE_INFO + std::to_string(uid);
+	std::string info_str;
+	std::shared_ptr<UserInfo> parsed;
+	if (RedisMgr::GetInstance()->Get(base_key, info_str) && Put(uid, info_str, parsed)) {
+		_redis_hits++;
+		return parsed;
+	}
+
+	// Redis 未命中或 JSON 异常：回源 MySQL
+	_db_loads++;
+	auto user_info = MysqlMgr::GetInstance()->GetUser(uid);
+	if (!user_info) {
+		UserExistFilter::GetInstance()->CountFalsePositive(uid);
+		Insert(uid, nullptr);
+		return nullptr;
+	}
+
+	// 写回 Redis 并广播失效，两条命令走同一次往返
+	std::vector<RedisValue> replies;
+	RedisMgr::GetInstance()->Pipeline({
+		{ "SET", base_key, DumpBaseInfo(*user_info) },
+		{ "PUBLISH", USER_CACHE_CHANNEL, std::to_string(uid) + "|" + _self_name },
+		}, replies);
+
+	Insert(uid, user_info);
+	return user_info;
+}
+
+bool UserInfoCache::Put(int uid, const std::string& info_str, std::shared_ptr<UserInfo>& userinfo) {
+	std::shared_ptr<UserInfo> parsed;
+	if (!ParseBaseInfo(info_str, parsed)) {
+		return false;
+	}
+	Insert(uid, parsed);
+	userinfo = parsed;
+	return true;
+}
+
+void UserInfoCache::Invalidate(int uid) {
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard.mtx);
+	auto iter = shard.entries.find(uid);
+	if (iter == shard.entries.end()) {
+		return;
+	}
+	shard.lru.erase(iter->second.lru_iter);
+	shard.entries.erase(iter);
+	_invalidations++;
+}
+
+void UserInfoCache::Clear() {
+	for (auto& shard : _shards) {
+		std::lock_guard<std::mutex> lock(shard.mtx);
+		shard.entries.clear();
+		shard.lru.clear();
+	}
+}
+
+void UserInfoCache::OnInvalidate(const std::string& message) {
+	auto pos = message.find('|');
+	if (pos != std::string::npos && message.compare(pos + 1, std::string::npos, _self_name) == 0) {
+		return;
+	}
+
+	try {
+		Invalidate(std::stoi(message.substr(0, pos)));
+	}
+	catch (std::exception& e) {
+		std::cout << "user cache invalidate message " << message << " invalid: " << e.what() << std::endl;
+	}
+}
+
+UserCacheStat UserInfoCache::GetStats() {
+	UserCacheStat stat;
+	for (auto& shard : _shards) {
+		std::lock_guard<std::mutex> lock(shard.mtx);
+		stat.size += shard.entries.size();
+	}
+	stat.hits = _hits;
+	stat.negative_hits = _negative_hits;
+	stat.misses = _misses;
+	stat.redis_hits = _redis_hits;
+	stat.db_loads = _db_loads;
+	stat.invalidations = _invalidations;
+	uint64_t loads = 0;
+	_loads.GetStats(loads, stat.coalesced);
+	return stat;
+}
+
+bool UserInfoCache::ParseBaseInfo(const std::string& info_str, std::shared_ptr<UserInfo>& userinfo)
+{
+	json root = json::parse(info_str, /*callback=*/nullptr, /*allow_exceptions=*/false);
+	if (root.is_discarded() || !root.is_object()) {
+		return false;
+	}
+
+	auto user_info = std::make_shared<UserInfo>();
+	user_info->uid = root.value("uid", 0);
+	user_info->name = root.value("name", std::string{});
+	user_info->pwd = root.value("pwd", std::string{});
+	user_info->email = root.value("email", std::string{});
+	user_info->nick = root.value("nick", std::string{});
+	user_info->desc = root.value("desc", std::string{});
+	user_info->sex = root.value("sex", 0);
+	user_info->icon = root.value("icon", std::string{});
+	userinfo = user_info;
+	return true;
+}
+
+std::string UserInfoCache::DumpBaseInfo(const UserInfo& userinfo)
+{
+	json root = {
+		{"uid",   userinfo.uid},
+		{"pwd",   userinfo.pwd},
+		{"name",  userinfo.name},
+		{"email", userinfo.email},
+		{"nick",  userinfo.nick},
+		{"desc",  userinfo.desc},
+		{"sex",   userinfo.sex},
+		{"icon",  userinfo.icon}
+	};
+	return root.dump();
+}
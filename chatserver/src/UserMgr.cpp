@@ -42,6 +42,11 @@ void UserMgr::RmvUserSession(int uid, std::string session_id)
 
 }
 
+std::mutex& UserMgr::GetBindMutex(int uid)
+{
+	return _bind_mtx[static_cast<unsigned int>(uid) % BIND_MUTEX_COUNT];
+}
+
 UserMgr::UserMgr()
 {
 
@@ -0,0 +1,416 @@
+#include "UserSearchIndex.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "MysqlMgr.h"
+#include "UserInfoCache.h"
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <iostream>
+
+// ASCII 转小写，其余字节原样保留，UTF-8 的前缀关系不变
+static std::string NormalizeKey(const std::string& text) {
+	std::string key = text;
+	for (auto& c : key) {
+		if (c >= 'A' && c <= 'Z') {
+			c = c - 'A' + 'a';
+		}
+	}
+	return key;
+}
+
+// 宽松的 UTF-8 解码，非法字节按单字节码点处理
+static std::u32string ToCodepoints(const std::string& text) {
+	std::u32string cps;
+	cps.reserve(text.size());
+	std::size_t i = 0;
+	while (i < text.size()) {
+		unsigned char c = text[i];
+		int len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 1;
+		if (i + len > text.size()) {
+			len = 1;
+		}
+		char32_t cp = len == 1 ? c : c & (0x7F >> len);
+		for (int k = 1; k < len; ++k) {
+			cp = (cp << 6) | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+		}
+		cps.push_back(cp);
+		i += len;
+	}
+	return cps;
+}
+
+// 相邻码点组成的二元组，首尾补 0 作为边界，去重后返回
+static std::vector<uint64_t> Bigrams(const std::u32string& cps) {
+	std::vector<uint64_t> grams;
+	if (cps.empty()) {
+		return grams;
+	}
+	grams.reserve(cps.size() + 1);
+	char32_t prev = 0;
+	for (auto cp : cps) {
+		grams.push_back((static_cast<uint64_t>(prev) << 32) | cp);
+		prev = cp;
+	}
+	grams.push_back(static_cast<uint64_t>(prev) << 32);
+	std::sort(grams.begin(), grams.end());
+	grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+	return grams;
+}
+
+// 编辑距离，相邻两字交换算一处错误，手机上输入 jhon 这类错误最常见
+static int EditDistance(const std::u32string& a, const std::u32string& b) {
+	std::vector<int> prev2(b.size() + 1);
+	std::vector<int> prev(b.size() + 1);
+	std::vector<int> row(b.size() + 1);
+	for (std::size_t j = 0; j <= b.size(); ++j) {
+		prev[j] = static_cast<int>(j);
+	}
+	for (std::size_t i = 1; i <= a.size(); ++i) {
+		row[0] = static_cast<int>(i);
+		for (std::size_t j = 1; j <= b.size(); ++j) {
+			int cost = a[i - 1] == b[j - 1] ? 0 : 1;
+			row[j] = (std::min)({ prev[j] + 1, row[j - 1] + 1, prev[j - 1] + cost });
+			if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) {
+				row[j] = (std::min)(row[j], prev2[j - 2] + 1);
+			}
+		}
+		prev2.swap(prev);
+		prev.swap(row);
+	}
+	return prev[b.size()];
+}
+
+// 与整个 key 或与 key 中同长度的前缀比较，取较小者，输入到一半打错也能匹配
+static int MatchDistance(const std::u32string& query, const std::u32string& cps) {
+	int full = EditDistance(query, cps);
+	if (cps.size() <= query.size()) {
+		return full;
+	}
+	return (std::min)(full, EditDistance(query, cps.substr(0, query.size())));
+}
+
+UserSearchIndex::UserSearchIndex() :_top_k(SEARCH_TOP_K), _load_batch(SEARCH_LOAD_BATCH),
+	_catchup_sec(SEARCH_CATCHUP_SEC), _max_uid(0), _b_ready(false), _b_stop(false), _b_catchup(false) {
+	auto& cfg = ConfigMgr::Inst();
+	auto top_k_str = cfg.GetValue("Search", "TopK");
+	if (!top_k_str.empty() && std::stoi(top_k_str) > 0) {
+		_top_k = std::stoi(top_k_str);
+	}
+
+	auto batch_str = cfg.GetValue("Search", "LoadBatch");
+	if (!batch_str.empty() && std::stoi(batch_str) > 0) {
+		_load_batch = std::stoi(batch_str);
+	}
+
+	auto catchup_str = cfg.GetValue("Search", "CatchupSec");
+	if (!catchup_str.empty() && std::stoi(catchup_str) > 0) {
+		_catchup_sec = std::stoi(catchup_str);
+	}
+}
+
+UserSearchIndex::~UserSearchIndex() {
+	Stop();
+}
+
+void UserSearchIndex::Start() {
+	RedisMgr::GetInstance()->Subscribe(USER_PROFILE_CHANNEL,
+		[this](const std::string& message) {
+			OnProfileChanged(message);
+		},
+		[this]() {
+			// 断线期间可能有新注册的用户
+			WakeLoader();
+		});
+
+	_loader = std::thread([this]() {
+		LoadLoop();
+	});
+}
+
+void UserSearchIndex::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(_load_mtx);
+		_b_stop = true;
+	}
+	_load_cond.notify_all();
+	if (_loader.joinable()) {
+		_loader.join();
+	}
+}
+
+void UserSearchIndex::WakeLoader() {
+	{
+		std::lock_guard<std::mutex> lock(_load_mtx);
+		_b_catchup = true;
+	}
+	_load_cond.notify_one();
+}
+
+void UserSearchIndex::LoadLoop() {
+	while (!_b_stop) {
+		std::vector<std::shared_ptr<UserInfo>> users;
+		bool success = MysqlMgr::GetInstance()->GetUsersAfter(_max_uid, _load_batch, users);
+		if (!users.empty()) {
+			std::unique_lock<std::shared_mutex> lock(_mtx);
+			for (auto& user : users) {
+				UpsertLocked(*user);
+			}
+		}
+
+		// 整批取满说明后面还有，继续取下一批
+		if (success && static_cast<int>(users.size()) == _load_batch) {
+			continue;
+		}
+
+		if (success && !_b_ready) {
+			_b_ready = true;
+			std::cout << "user search index ready, max uid " << _max_uid << std::endl;
+		}
+
+		std::unique_lock<std::mutex> lock(_load_mtx);
+		_load_cond.wait_for(lock, std::chrono::seconds(_catchup_sec), [this]() {
+			return _b_stop || _b_catchup;
+		});
+		_b_catchup = false;
+	}
+}
+
+void UserSearchIndex::OnProfileChanged(const std::string& message) {
+	// 消息格式为 "uid|name"，名字由重新读取的资料为准
+	int uid = 0;
+	try {
+		uid = std::stoi(message.substr(0, message.find('|')));
+	}
+	catch (std::exception& e) {
+		std::cout << "user profile message " << message << " invalid: " << e.what() << std::endl;
+		return;
+	}
+
+	// 新注册的用户由加载线程按 uid 顺序补齐，保证 _max_uid 之前没有空洞
+	if (uid > _max_uid) {
+		WakeLoader();
+		return;
+	}
+
+	// 已加载过的用户修改了资料，进程内缓存一并失效
+	UserInfoCache::GetInstance()->Invalidate(uid);
+	auto user = MysqlMgr::GetInstance()->GetUser(uid);
+	if (user) {
+		Upsert(*user);
+	}
+	else {
+		Remove(uid);
+	}
+}
+
+void UserSearchIndex::Upsert(const UserInfo& user) {
+	std::unique_lock<std::shared_mutex> lock(_mtx);
+	UpsertLocked(user);
+}
+
+void UserSearchIndex::Remove(int uid) {
+	std::unique_lock<std::shared_mutex> lock(_mtx);
+	RemoveLocked(uid);
+}
+
+void UserSearchIndex::UpsertLocked(const UserInfo& user) {
+	RemoveLocked(user.uid);
+
+	Doc doc;
+	doc.name = user.name;
+	doc.nick = user.nick;
+	doc.desc = user.desc;
+	doc.icon = user.icon;
+	doc.sex = user.sex;
+	doc.name_key = NormalizeKey(user.name);
+	doc.nick_key = NormalizeKey(user.nick);
+	doc.name_cps = ToCodepoints(doc.name_key);
+	doc.nick_cps = ToCodepoints(doc.nick_key);
+	IndexDoc(user.uid, doc, true);
+	_docs.emplace(user.uid, std::move(doc));
+
+	int max_uid = _max_uid;
+	while (user.uid > max_uid && !_max_uid.compare_exchange_weak(max_uid, user.uid)) {
+	}
+}
+
+void UserSearchIndex::RemoveLocked(int uid) {
+	auto iter = _docs.find(uid);
+	if (iter == _docs.end()) {
+		return;
+	}
+	IndexDoc(uid, iter->second, false);
+	_docs.erase(iter);
+}
+
+// 名字和昵称共用一份二元组，同一用户在每个倒排表中只出现一次
+void UserSearchIndex::IndexDoc(int uid, const Doc& doc, bool b_add) {
+	std::vector<uint64_t> grams;
+	for (auto key : { std::make_pair(&doc.name_key, &doc.name_cps), std::make_pair(&doc.nick_key, &doc.nick_cps) }) {
+		if (key.first->empty()) {
+			continue;
+		}
+		if (b_add) {
+			_prefix.emplace(*key.first, uid);
+		}
+		else {
+			_prefix.erase({ *key.first, uid });
+		}
+		auto key_grams = Bigrams(*key.second);
+		grams.insert(grams.end(), key_grams.begin(), key_grams.end());
+	}
+	std::sort(grams.begin(), grams.end());
+	grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+
+	for (auto gram : grams) {
+		if (b_add) {
+			_grams[gram].push_back(uid);
+			continue;
+		}
+		auto iter = _grams.find(gram);
+		if (iter == _grams.end()) {
+			continue;
+		}
+		auto& postings = iter->second;
+		auto pos = std::find(postings.begin(), postings.end(), uid);
+		if (pos != postings.end()) {
+			*pos = postings.back();
+			postings.pop_back();
+		}
+		if (postings.empty()) {
+			_grams.erase(iter);
+		}
+	}
+}
+
+std::vector<SearchHit> UserSearchIndex::Search(const std::string& query, std::size_t top_k) {
+	auto start_us = LatencyRecorder::NowUs();
+	std::vector<SearchHit> hits;
+	auto key = NormalizeKey(query);
+	if (key.empty() || top_k == 0) {
+		return hits;
+	}
+
+	std::unordered_map<int, int> best;
+	auto consider = [&best](int uid, int score) {
+		auto iter = best.find(uid);
+		if (iter == best.end() || score < iter->second) {
+			best[uid] = score;
+		}
+	};
+
+	std::shared_lock<std::shared_mutex> lock(_mtx);
+
+	// uid 精确匹配
+	if (key.size() < 10 && std::all_of(key.begin(), key.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+		int uid = std::stoi(key);
+		if (_docs.count(uid) > 0) {
+			consider(uid, 0);
+		}
+	}
+
+	// 前缀匹配：有序集合中从 key 开始的一段，剩余越短越靠前，只扫描有限条
+	std::size_t scanned = 0;
+	for (auto iter = _prefix.lower_bound({ key, INT_MIN });
+		iter != _prefix.end() && iter->first.compare(0, key.size(), key) == 0 && scanned < top_k * 32;
+		++iter, ++scanned) {
+		auto& doc = _docs.at(iter->second);
+		int rest = static_cast<int>((std::min)(iter->first.size() - key.size(), std::size_t(49)));
+		bool b_name = iter->first == doc.name_key;
+		consider(iter->second, (rest == 0 ? 1 : 100) + (b_name ? 0 : 50) + rest);
+	}
+
+	// 容错匹配：前缀已经足够时跳过
+	auto cps = ToCodepoints(key);
+	int max_edits = cps.size() <= 2 ? 0 : cps.size() <= 5 ? 1 : 2;
+	if (max_edits > 0 && best.size() < top_k) {
+		std::unordered_map<int, int> counts;
+		int used = 0;
+		for (auto gram : Bigrams(cps)) {
+			auto iter = _grams.find(gram);
+			if (iter == _grams.end() || iter->second.size() > SEARCH_MAX_POSTINGS) {
+				continue;
+			}
+			used++;
+			for (auto uid : iter->second) {
+				counts[uid]++;
+			}
+		}
+
+		// 增删改一处最多破坏两个二元组，交换相邻两字最多破坏三个。
+		// 短查询按公式只剩 1 个，几乎所有含其中一个字的用户都会成为候选，因此设下限，
+		// 代价是三个字的查询里交换相邻两字的错误可能匹配不到
+		int threshold = (std::max)(SEARCH_MIN_SHARED_GRAMS, used - 3 * max_edits);
+		std::vector<std::pair<int, int>> candidates;
+		for (auto& count : counts) {
+			if (count.second >= threshold) {
+				candidates.emplace_back(count.second, count.first);
+			}
+		}
+
+		// 共有二元组越多越可能在距离以内，超出上限时只校验最前面的一批
+		if (candidates.size() > SEARCH_MAX_FUZZY_CANDIDATES) {
+			std::nth_element(candidates.begin(), candidates.begin() + SEARCH_MAX_FUZZY_CANDIDATES, candidates.end(),
+				std::greater<std::pair<int, int>>());
+			candidates.resize(SEARCH_MAX_FUZZY_CANDIDATES);
+		}
+
+		for (auto& candidate : candidates) {
+			auto& doc = _docs.at(candidate.second);
+			int name_dist = doc.name_cps.empty() ? INT_MAX : MatchDistance(cps, doc.name_cps);
+			int nick_dist = doc.nick_cps.empty() ? INT_MAX : MatchDistance(cps, doc.nick_cps);
+			int dist = (std::min)(name_dist, nick_dist);
+			if (dist <= max_edits) {
+				consider(candidate.second, 200 + dist * 20 + (name_dist <= nick_dist ? 0 : 10));
+			}
+		}
+	}
+
+	std::vector<std::pair<int, int>> ranked;
+	ranked.reserve(best.size());
+	for (auto& item : best) {
+		ranked.emplace_back(item.second, item.first);
+	}
+	std::sort(ranked.begin(), ranked.end());
+	if (ranked.size() > top_k) {
+		ranked.resize(top_k);
+	}
+
+	for (auto& item : ranked) {
+		auto& doc = _docs.at(item.second);
+		SearchHit hit;
+		hit.uid = item.second;
+		hit.name = doc.name;
+		hit.nick = doc.nick;
+		hit.desc = doc.desc;
+		hit.icon = doc.icon;
+		hit.sex = doc.sex;
+		hit.score = item.first;
+		hits.push_back(std::move(hit));
+	}
+	lock.unlock();
+
+	_latency.Record(LatencyRecorder::NowUs() - start_us);
+	return hits;
+}
+
+bool UserSearchIndex::IsReady() {
+	return _b_ready;
+}
+
+std::size_t UserSearchIndex::GetTopK() {
+	return _top_k;
+}
+
+SearchIndexStat UserSearchIndex::GetStats() {
+	SearchIndexStat stat;
+	stat.b_ready = _b_ready;
+	stat.max_uid = _max_uid;
+	{
+		std::shared_lock<std::shared_mutex> lock(_mtx);
+		stat.users = _docs.size();
+	}
+	stat.latency = _latency.Take();
+	return stat;
+}
@@ -1,6095 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: message.proto
-// Protobuf C++ Version: 5.29.5
-
-#include "message.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace message {
-
-inline constexpr TextChatData::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : msgid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        msgcontent_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TextChatData::TextChatData(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TextChatDataDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TextChatDataDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TextChatDataDefaultTypeInternal() {}
-  union {
-    TextChatData _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextChatDataDefaultTypeInternal _TextChatData_default_instance_;
-
-inline constexpr SendChatMsgRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : error_{0},
-        fromuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SendChatMsgRsp::SendChatMsgRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SendChatMsgRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SendChatMsgRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SendChatMsgRspDefaultTypeInternal() {}
-  union {
-    SendChatMsgRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendChatMsgRspDefaultTypeInternal _SendChatMsgRsp_default_instance_;
-
-inline constexpr SendChatMsgReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : message_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        fromuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SendChatMsgReq::SendChatMsgReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SendChatMsgReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SendChatMsgReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SendChatMsgReqDefaultTypeInternal() {}
-  union {
-    SendChatMsgReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendChatMsgReqDefaultTypeInternal _SendChatMsgReq_default_instance_;
-
-inline constexpr RplyFriendRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : error_{0},
-        rplyuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RplyFriendRsp::RplyFriendRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RplyFriendRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RplyFriendRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RplyFriendRspDefaultTypeInternal() {}
-  union {
-    RplyFriendRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RplyFriendRspDefaultTypeInternal _RplyFriendRsp_default_instance_;
-
-inline constexpr RplyFriendReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : rplyuid_{0},
-        agree_{false},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RplyFriendReq::RplyFriendReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RplyFriendReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RplyFriendReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RplyFriendReqDefaultTypeInternal() {}
-  union {
-    RplyFriendReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RplyFriendReqDefaultTypeInternal _RplyFriendReq_default_instance_;
-
-inline constexpr LoginRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : token_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        error_{0},
-        uid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR LoginRsp::LoginRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct LoginRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR LoginRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~LoginRspDefaultTypeInternal() {}
-  union {
-    LoginRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginRspDefaultTypeInternal _LoginRsp_default_instance_;
-
-inline constexpr LoginReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : token_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        uid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR LoginReq::LoginReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct LoginReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR LoginReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~LoginReqDefaultTypeInternal() {}
-  union {
-    LoginReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginReqDefaultTypeInternal _LoginReq_default_instance_;
-
-inline constexpr KickUserRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : error_{0},
-        uid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR KickUserRsp::KickUserRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct KickUserRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR KickUserRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~KickUserRspDefaultTypeInternal() {}
-  union {
-    KickUserRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickUserRspDefaultTypeInternal _KickUserRsp_default_instance_;
-
-inline constexpr KickUserReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : uid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR KickUserReq::KickUserReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct KickUserReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR KickUserReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~KickUserReqDefaultTypeInternal() {}
-  union {
-    KickUserReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickUserReqDefaultTypeInternal _KickUserReq_default_instance_;
-
-inline constexpr GetVarifyRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : email_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        error_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetVarifyRsp::GetVarifyRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetVarifyRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetVarifyRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetVarifyRspDefaultTypeInternal() {}
-  union {
-    GetVarifyRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetVarifyRspDefaultTypeInternal _GetVarifyRsp_default_instance_;
-
-inline constexpr GetVarifyReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : email_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetVarifyReq::GetVarifyReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetVarifyReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetVarifyReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetVarifyReqDefaultTypeInternal() {}
-  union {
-    GetVarifyReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetVarifyReqDefaultTypeInternal _GetVarifyReq_default_instance_;
-
-inline constexpr GetChatServerRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : host_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        port_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        token_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        error_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetChatServerRsp::GetChatServerRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetChatServerRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetChatServerRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetChatServerRspDefaultTypeInternal() {}
-  union {
-    GetChatServerRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetChatServerRspDefaultTypeInternal _GetChatServerRsp_default_instance_;
-
-inline constexpr GetChatServerReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : uid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetChatServerReq::GetChatServerReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetChatServerReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetChatServerReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetChatServerReqDefaultTypeInternal() {}
-  union {
-    GetChatServerReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetChatServerReqDefaultTypeInternal _GetChatServerReq_default_instance_;
-
-inline constexpr AuthFriendRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : error_{0},
-        fromuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AuthFriendRsp::AuthFriendRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AuthFriendRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AuthFriendRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AuthFriendRspDefaultTypeInternal() {}
-  union {
-    AuthFriendRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AuthFriendRspDefaultTypeInternal _AuthFriendRsp_default_instance_;
-
-inline constexpr AuthFriendReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : fromuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AuthFriendReq::AuthFriendReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AuthFriendReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AuthFriendReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AuthFriendReqDefaultTypeInternal() {}
-  union {
-    AuthFriendReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AuthFriendReqDefaultTypeInternal _AuthFriendReq_default_instance_;
-
-inline constexpr AddFriendRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : error_{0},
-        applyuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AddFriendRsp::AddFriendRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AddFriendRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AddFriendRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AddFriendRspDefaultTypeInternal() {}
-  union {
-    AddFriendRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AddFriendRspDefaultTypeInternal _AddFriendRsp_default_instance_;
-
-inline constexpr AddFriendReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        desc_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        icon_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        nick_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        applyuid_{0},
-        sex_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AddFriendReq::AddFriendReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AddFriendReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AddFriendReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AddFriendReqDefaultTypeInternal() {}
-  union {
-    AddFriendReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AddFriendReqDefaultTypeInternal _AddFriendReq_default_instance_;
-
-inline constexpr TextChatMsgRsp::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : textmsgs_{},
-        error_{0},
-        fromuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TextChatMsgRsp::TextChatMsgRsp(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TextChatMsgRspDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TextChatMsgRspDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TextChatMsgRspDefaultTypeInternal() {}
-  union {
-    TextChatMsgRsp _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextChatMsgRspDefaultTypeInternal _TextChatMsgRsp_default_instance_;
-
-inline constexpr TextChatMsgReq::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : textmsgs_{},
-        fromuid_{0},
-        touid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TextChatMsgReq::TextChatMsgReq(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TextChatMsgReqDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TextChatMsgReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TextChatMsgReqDefaultTypeInternal() {}
-  union {
-    TextChatMsgReq _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextChatMsgReqDefaultTypeInternal _TextChatMsgReq_default_instance_;
-}  // namespace message
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_message_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_message_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_message_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::GetVarifyReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::GetVarifyReq, _impl_.email_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::GetVarifyRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::GetVarifyRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::GetVarifyRsp, _impl_.email_),
-        PROTOBUF_FIELD_OFFSET(::message::GetVarifyRsp, _impl_.code_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::GetChatServerReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::GetChatServerReq, _impl_.uid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::GetChatServerRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::GetChatServerRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::GetChatServerRsp, _impl_.host_),
-        PROTOBUF_FIELD_OFFSET(::message::GetChatServerRsp, _impl_.port_),
-        PROTOBUF_FIELD_OFFSET(::message::GetChatServerRsp, _impl_.token_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::LoginReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::LoginReq, _impl_.uid_),
-        PROTOBUF_FIELD_OFFSET(::message::LoginReq, _impl_.token_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::LoginRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::LoginRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::LoginRsp, _impl_.uid_),
-        PROTOBUF_FIELD_OFFSET(::message::LoginRsp, _impl_.token_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _impl_.applyuid_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _impl_.name_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _impl_.desc_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _impl_.icon_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _impl_.nick_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _impl_.sex_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendReq, _impl_.touid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendRsp, _impl_.applyuid_),
-        PROTOBUF_FIELD_OFFSET(::message::AddFriendRsp, _impl_.touid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendReq, _impl_.rplyuid_),
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendReq, _impl_.agree_),
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendReq, _impl_.touid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendRsp, _impl_.rplyuid_),
-        PROTOBUF_FIELD_OFFSET(::message::RplyFriendRsp, _impl_.touid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgReq, _impl_.fromuid_),
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgReq, _impl_.touid_),
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgReq, _impl_.message_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgRsp, _impl_.fromuid_),
-        PROTOBUF_FIELD_OFFSET(::message::SendChatMsgRsp, _impl_.touid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::AuthFriendReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::AuthFriendReq, _impl_.fromuid_),
-        PROTOBUF_FIELD_OFFSET(::message::AuthFriendReq, _impl_.touid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::AuthFriendRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::AuthFriendRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::AuthFriendRsp, _impl_.fromuid_),
-        PROTOBUF_FIELD_OFFSET(::message::AuthFriendRsp, _impl_.touid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.fromuid_),
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.touid_),
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.textmsgs_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::TextChatData, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::TextChatData, _impl_.msgid_),
-        PROTOBUF_FIELD_OFFSET(::message::TextChatData, _impl_.msgcontent_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.fromuid_),
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.touid_),
-        PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.textmsgs_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::KickUserReq, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::KickUserReq, _impl_.uid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::message::KickUserRsp, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::message::KickUserRsp, _impl_.error_),
-        PROTOBUF_FIELD_OFFSET(::message::KickUserRsp, _impl_.uid_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::message::GetVarifyReq)},
-        {9, -1, -1, sizeof(::message::GetVarifyRsp)},
-        {20, -1, -1, sizeof(::message::GetChatServerReq)},
-        {29, -1, -1, sizeof(::message::GetChatServerRsp)},
-        {41, -1, -1, sizeof(::message::LoginReq)},
-        {51, -1, -1, sizeof(::message::LoginRsp)},
-        {62, -1, -1, sizeof(::message::AddFriendReq)},
-        {77, -1, -1, sizeof(::message::AddFriendRsp)},
-        {88, -1, -1, sizeof(::message::RplyFriendReq)},
-        {99, -1, -1, sizeof(::message::RplyFriendRsp)},
-        {110, -1, -1, sizeof(::message::SendChatMsgReq)},
-        {121, -1, -1, sizeof(::message::SendChatMsgRsp)},
-        {132, -1, -1, sizeof(::message::AuthFriendReq)},
-        {142, -1, -1, sizeof(::message::AuthFriendRsp)},
-        {153, -1, -1, sizeof(::message::TextChatMsgReq)},
-        {164, -1, -1, sizeof(::message::TextChatData)},
-        {174, -1, -1, sizeof(::message::TextChatMsgRsp)},
-        {186, -1, -1, sizeof(::message::KickUserReq)},
-        {195, -1, -1, sizeof(::message::KickUserRsp)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::message::_GetVarifyReq_default_instance_._instance,
-    &::message::_GetVarifyRsp_default_instance_._instance,
-    &::message::_GetChatServerReq_default_instance_._instance,
-    &::message::_GetChatServerRsp_default_instance_._instance,
-    &::message::_LoginReq_default_instance_._instance,
-    &::message::_LoginRsp_default_instance_._instance,
-    &::message::_AddFriendReq_default_instance_._instance,
-    &::message::_AddFriendRsp_default_instance_._instance,
-    &::message::_RplyFriendReq_default_instance_._instance,
-    &::message::_RplyFriendRsp_default_instance_._instance,
-    &::message::_SendChatMsgReq_default_instance_._instance,
-    &::message::_SendChatMsgRsp_default_instance_._instance,
-    &::message::_AuthFriendReq_default_instance_._instance,
-    &::message::_AuthFriendRsp_default_instance_._instance,
-    &::message::_TextChatMsgReq_default_instance_._instance,
-    &::message::_TextChatData_default_instance_._instance,
-    &::message::_TextChatMsgRsp_default_instance_._instance,
-    &::message::_KickUserReq_default_instance_._instance,
-    &::message::_KickUserRsp_default_instance_._instance,
-};
-const char descriptor_table_protodef_message_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\rmessage.proto\022\007message\"\035\n\014GetVarifyReq"
-    "\022\r\n\005email\030\001 \001(\t\":\n\014GetVarifyRsp\022\r\n\005error"
-    "\030\001 \001(\005\022\r\n\005email\030\002 \001(\t\022\014\n\004code\030\003 \001(\t\"\037\n\020G"
-    "etChatServerReq\022\013\n\003uid\030\001 \001(\005\"L\n\020GetChatS"
-    "erverRsp\022\r\n\005error\030\001 \001(\005\022\014\n\004host\030\002 \001(\t\022\014\n"
-    "\004port\030\003 \001(\t\022\r\n\005token\030\004 \001(\t\"&\n\010LoginReq\022\013"
-    "\n\003uid\030\001 \001(\005\022\r\n\005token\030\002 \001(\t\"5\n\010LoginRsp\022\r"
-    "\n\005error\030\001 \001(\005\022\013\n\003uid\030\002 \001(\005\022\r\n\005token\030\003 \001("
-    "\t\"t\n\014AddFriendReq\022\020\n\010applyuid\030\001 \001(\005\022\014\n\004n"
-    "ame\030\002 \001(\t\022\014\n\004desc\030\003 \001(\t\022\014\n\004icon\030\004 \001(\t\022\014\n"
-    "\004nick\030\005 \001(\t\022\013\n\003sex\030\006 \001(\005\022\r\n\005touid\030\007 \001(\005\""
-    ">\n\014AddFriendRsp\022\r\n\005error\030\001 \001(\005\022\020\n\010applyu"
-    "id\030\002 \001(\005\022\r\n\005touid\030\003 \001(\005\">\n\rRplyFriendReq"
-    "\022\017\n\007rplyuid\030\001 \001(\005\022\r\n\005agree\030\002 \001(\010\022\r\n\005toui"
-    "d\030\003 \001(\005\">\n\rRplyFriendRsp\022\r\n\005error\030\001 \001(\005\022"
-    "\017\n\007rplyuid\030\002 \001(\005\022\r\n\005touid\030\003 \001(\005\"A\n\016SendC"
-    "hatMsgReq\022\017\n\007fromuid\030\001 \001(\005\022\r\n\005touid\030\002 \001("
-    "\005\022\017\n\007message\030\003 \001(\t\"\?\n\016SendChatMsgRsp\022\r\n\005"
-    "error\030\001 \001(\005\022\017\n\007fromuid\030\002 \001(\005\022\r\n\005touid\030\003 "
-    "\001(\005\"/\n\rAuthFriendReq\022\017\n\007fromuid\030\001 \001(\005\022\r\n"
-    "\005touid\030\002 \001(\005\">\n\rAuthFriendRsp\022\r\n\005error\030\001"
-    " \001(\005\022\017\n\007fromuid\030\002 \001(\005\022\r\n\005touid\030\003 \001(\005\"Y\n\016"
-    "TextChatMsgReq\022\017\n\007fromuid\030\001 \001(\005\022\r\n\005touid"
-    "\030\002 \001(\005\022\'\n\010textmsgs\030\003 \003(\0132\025.message.TextC"
-    "hatData\"1\n\014TextChatData\022\r\n\005msgid\030\001 \001(\t\022\022"
-    "\n\nmsgcontent\030\002 \001(\t\"h\n\016TextChatMsgRsp\022\r\n\005"
-    "error\030\001 \001(\005\022\017\n\007fromuid\030\002 \001(\005\022\r\n\005touid\030\003 "
-    "\001(\005\022\'\n\010textmsgs\030\004 \003(\0132\025.message.TextChat"
-    "Data\"\032\n\013KickUserReq\022\013\n\003uid\030\001 \001(\005\")\n\013Kick"
-    "UserRsp\022\r\n\005error\030\001 \001(\005\022\013\n\003uid\030\002 \001(\0052P\n\rV"
-    "arifyService\022\?\n\rGetVarifyCode\022\025.message."
-    "GetVarifyReq\032\025.message.GetVarifyRsp\"\0002\207\001"
-    "\n\rStatusService\022G\n\rGetChatServer\022\031.messa"
-    "ge.GetChatServerReq\032\031.message.GetChatSer"
-    "verRsp\"\000\022-\n\005Login\022\021.message.LoginReq\032\021.m"
-    "essage.LoginRsp2\245\003\n\013ChatService\022A\n\017Notif"
-    "yAddFriend\022\025.message.AddFriendReq\032\025.mess"
-    "age.AddFriendRsp\"\000\022A\n\rRplyAddFriend\022\026.me"
-    "ssage.RplyFriendReq\032\026.message.RplyFriend"
-    "Rsp\"\000\022A\n\013SendChatMsg\022\027.message.SendChatM"
-    "sgReq\032\027.message.SendChatMsgRsp\"\000\022D\n\020Noti"
-    "fyAuthFriend\022\026.message.AuthFriendReq\032\026.m"
-    "essage.AuthFriendRsp\"\000\022G\n\021NotifyTextChat"
-    "Msg\022\027.message.TextChatMsgReq\032\027.message.T"
-    "extChatMsgRsp\"\000\022>\n\016NotifyKickUser\022\024.mess"
-    "age.KickUserReq\032\024.message.KickUserRsp\"\000b"
-    "\006proto3"
-};
-static ::absl::once_flag descriptor_table_message_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_message_2eproto = {
-    false,
-    false,
-    1847,
-    descriptor_table_protodef_message_2eproto,
-    "message.proto",
-    &descriptor_table_message_2eproto_once,
-    nullptr,
-    0,
-    19,
-    schemas,
-    file_default_instances,
-    TableStruct_message_2eproto::offsets,
-    file_level_enum_descriptors_message_2eproto,
-    file_level_service_descriptors_message_2eproto,
-};
-namespace message {
-// ===================================================================
-
-class GetVarifyReq::_Internal {
- public:
-};
-
-GetVarifyReq::GetVarifyReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.GetVarifyReq)
-}
-inline PROTOBUF_NDEBUG_INLINE GetVarifyReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::GetVarifyReq& from_msg)
-      : email_(arena, from.email_),
-        _cached_size_{0} {}
-
-GetVarifyReq::GetVarifyReq(
-    ::google::protobuf::Arena* arena,
-    const GetVarifyReq& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetVarifyReq* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:message.GetVarifyReq)
-}
-inline PROTOBUF_NDEBUG_INLINE GetVarifyReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : email_(arena),
-        _cached_size_{0} {}
-
-inline void GetVarifyReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetVarifyReq::~GetVarifyReq() {
-  // @@protoc_insertion_point(destructor:message.GetVarifyReq)
-  SharedDtor(*this);
-}
-inline void GetVarifyReq::SharedDtor(MessageLite& self) {
-  GetVarifyReq& this_ = static_cast<GetVarifyReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.email_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetVarifyReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetVarifyReq(arena);
-}
-constexpr auto GetVarifyReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetVarifyReq),
-                                            alignof(GetVarifyReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetVarifyReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetVarifyReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetVarifyReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetVarifyReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetVarifyReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetVarifyReq>(), &GetVarifyReq::ByteSizeLong,
-            &GetVarifyReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetVarifyReq, _impl_._cached_size_),
-        false,
-    },
-    &GetVarifyReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetVarifyReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 34, 2> GetVarifyReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::GetVarifyReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string email = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetVarifyReq, _impl_.email_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string email = 1;
-    {PROTOBUF_FIELD_OFFSET(GetVarifyReq, _impl_.email_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\24\5\0\0\0\0\0\0"
-    "message.GetVarifyReq"
-    "email"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetVarifyReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.GetVarifyReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.email_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetVarifyReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetVarifyReq& this_ = static_cast<const GetVarifyReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetVarifyReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetVarifyReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.GetVarifyReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string email = 1;
-          if (!this_._internal_email().empty()) {
-            const std::string& _s = this_._internal_email();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.GetVarifyReq.email");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.GetVarifyReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetVarifyReq::ByteSizeLong(const MessageLite& base) {
-          const GetVarifyReq& this_ = static_cast<const GetVarifyReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetVarifyReq::ByteSizeLong() const {
-          const GetVarifyReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.GetVarifyReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // string email = 1;
-            if (!this_._internal_email().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_email());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetVarifyReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetVarifyReq*>(&to_msg);
-  auto& from = static_cast<const GetVarifyReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.GetVarifyReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_email().empty()) {
-    _this->_internal_set_email(from._internal_email());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetVarifyReq::CopyFrom(const GetVarifyReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.GetVarifyReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetVarifyReq::InternalSwap(GetVarifyReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
-}
-
-::google::protobuf::Metadata GetVarifyReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetVarifyRsp::_Internal {
- public:
-};
-
-GetVarifyRsp::GetVarifyRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.GetVarifyRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE GetVarifyRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::GetVarifyRsp& from_msg)
-      : email_(arena, from.email_),
-        code_(arena, from.code_),
-        _cached_size_{0} {}
-
-GetVarifyRsp::GetVarifyRsp(
-    ::google::protobuf::Arena* arena,
-    const GetVarifyRsp& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetVarifyRsp* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.error_ = from._impl_.error_;
-
-  // @@protoc_insertion_point(copy_constructor:message.GetVarifyRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE GetVarifyRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : email_(arena),
-        code_(arena),
-        _cached_size_{0} {}
-
-inline void GetVarifyRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.error_ = {};
-}
-GetVarifyRsp::~GetVarifyRsp() {
-  // @@protoc_insertion_point(destructor:message.GetVarifyRsp)
-  SharedDtor(*this);
-}
-inline void GetVarifyRsp::SharedDtor(MessageLite& self) {
-  GetVarifyRsp& this_ = static_cast<GetVarifyRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.email_.Destroy();
-  this_._impl_.code_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetVarifyRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetVarifyRsp(arena);
-}
-constexpr auto GetVarifyRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetVarifyRsp),
-                                            alignof(GetVarifyRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetVarifyRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetVarifyRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetVarifyRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetVarifyRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetVarifyRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetVarifyRsp>(), &GetVarifyRsp::ByteSizeLong,
-            &GetVarifyRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetVarifyRsp, _impl_._cached_size_),
-        false,
-    },
-    &GetVarifyRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetVarifyRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 38, 2> GetVarifyRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::GetVarifyRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetVarifyRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetVarifyRsp, _impl_.error_)}},
-    // string email = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetVarifyRsp, _impl_.email_)}},
-    // string code = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GetVarifyRsp, _impl_.code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(GetVarifyRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string email = 2;
-    {PROTOBUF_FIELD_OFFSET(GetVarifyRsp, _impl_.email_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string code = 3;
-    {PROTOBUF_FIELD_OFFSET(GetVarifyRsp, _impl_.code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\24\0\5\4\0\0\0\0"
-    "message.GetVarifyRsp"
-    "email"
-    "code"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetVarifyRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.GetVarifyRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.email_.ClearToEmpty();
-  _impl_.code_.ClearToEmpty();
-  _impl_.error_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetVarifyRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetVarifyRsp& this_ = static_cast<const GetVarifyRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetVarifyRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetVarifyRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.GetVarifyRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // string email = 2;
-          if (!this_._internal_email().empty()) {
-            const std::string& _s = this_._internal_email();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.GetVarifyRsp.email");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string code = 3;
-          if (!this_._internal_code().empty()) {
-            const std::string& _s = this_._internal_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.GetVarifyRsp.code");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.GetVarifyRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetVarifyRsp::ByteSizeLong(const MessageLite& base) {
-          const GetVarifyRsp& this_ = static_cast<const GetVarifyRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetVarifyRsp::ByteSizeLong() const {
-          const GetVarifyRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.GetVarifyRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string email = 2;
-            if (!this_._internal_email().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_email());
-            }
-            // string code = 3;
-            if (!this_._internal_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_code());
-            }
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetVarifyRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetVarifyRsp*>(&to_msg);
-  auto& from = static_cast<const GetVarifyRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.GetVarifyRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_email().empty()) {
-    _this->_internal_set_email(from._internal_email());
-  }
-  if (!from._internal_code().empty()) {
-    _this->_internal_set_code(from._internal_code());
-  }
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetVarifyRsp::CopyFrom(const GetVarifyRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.GetVarifyRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetVarifyRsp::InternalSwap(GetVarifyRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.code_, &other->_impl_.code_, arena);
-        swap(_impl_.error_, other->_impl_.error_);
-}
-
-::google::protobuf::Metadata GetVarifyRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetChatServerReq::_Internal {
- public:
-};
-
-GetChatServerReq::GetChatServerReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.GetChatServerReq)
-}
-GetChatServerReq::GetChatServerReq(
-    ::google::protobuf::Arena* arena, const GetChatServerReq& from)
-    : GetChatServerReq(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE GetChatServerReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void GetChatServerReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.uid_ = {};
-}
-GetChatServerReq::~GetChatServerReq() {
-  // @@protoc_insertion_point(destructor:message.GetChatServerReq)
-  SharedDtor(*this);
-}
-inline void GetChatServerReq::SharedDtor(MessageLite& self) {
-  GetChatServerReq& this_ = static_cast<GetChatServerReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* GetChatServerReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetChatServerReq(arena);
-}
-constexpr auto GetChatServerReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GetChatServerReq),
-                                            alignof(GetChatServerReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetChatServerReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetChatServerReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetChatServerReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetChatServerReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetChatServerReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetChatServerReq>(), &GetChatServerReq::ByteSizeLong,
-            &GetChatServerReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetChatServerReq, _impl_._cached_size_),
-        false,
-    },
-    &GetChatServerReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetChatServerReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> GetChatServerReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::GetChatServerReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 uid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetChatServerReq, _impl_.uid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetChatServerReq, _impl_.uid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 uid = 1;
-    {PROTOBUF_FIELD_OFFSET(GetChatServerReq, _impl_.uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetChatServerReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.GetChatServerReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.uid_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetChatServerReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetChatServerReq& this_ = static_cast<const GetChatServerReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetChatServerReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetChatServerReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.GetChatServerReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 uid = 1;
-          if (this_._internal_uid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_uid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.GetChatServerReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetChatServerReq::ByteSizeLong(const MessageLite& base) {
-          const GetChatServerReq& this_ = static_cast<const GetChatServerReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetChatServerReq::ByteSizeLong() const {
-          const GetChatServerReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.GetChatServerReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // int32 uid = 1;
-            if (this_._internal_uid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_uid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetChatServerReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetChatServerReq*>(&to_msg);
-  auto& from = static_cast<const GetChatServerReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.GetChatServerReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_uid() != 0) {
-    _this->_impl_.uid_ = from._impl_.uid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetChatServerReq::CopyFrom(const GetChatServerReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.GetChatServerReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetChatServerReq::InternalSwap(GetChatServerReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.uid_, other->_impl_.uid_);
-}
-
-::google::protobuf::Metadata GetChatServerReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetChatServerRsp::_Internal {
- public:
-};
-
-GetChatServerRsp::GetChatServerRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.GetChatServerRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE GetChatServerRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::GetChatServerRsp& from_msg)
-      : host_(arena, from.host_),
-        port_(arena, from.port_),
-        token_(arena, from.token_),
-        _cached_size_{0} {}
-
-GetChatServerRsp::GetChatServerRsp(
-    ::google::protobuf::Arena* arena,
-    const GetChatServerRsp& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetChatServerRsp* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.error_ = from._impl_.error_;
-
-  // @@protoc_insertion_point(copy_constructor:message.GetChatServerRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE GetChatServerRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : host_(arena),
-        port_(arena),
-        token_(arena),
-        _cached_size_{0} {}
-
-inline void GetChatServerRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.error_ = {};
-}
-GetChatServerRsp::~GetChatServerRsp() {
-  // @@protoc_insertion_point(destructor:message.GetChatServerRsp)
-  SharedDtor(*this);
-}
-inline void GetChatServerRsp::SharedDtor(MessageLite& self) {
-  GetChatServerRsp& this_ = static_cast<GetChatServerRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.host_.Destroy();
-  this_._impl_.port_.Destroy();
-  this_._impl_.token_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetChatServerRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetChatServerRsp(arena);
-}
-constexpr auto GetChatServerRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetChatServerRsp),
-                                            alignof(GetChatServerRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetChatServerRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetChatServerRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetChatServerRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetChatServerRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetChatServerRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetChatServerRsp>(), &GetChatServerRsp::ByteSizeLong,
-            &GetChatServerRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_._cached_size_),
-        false,
-    },
-    &GetChatServerRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetChatServerRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 46, 2> GetChatServerRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::GetChatServerRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string token = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.token_)}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetChatServerRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.error_)}},
-    // string host = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.host_)}},
-    // string port = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.port_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string host = 2;
-    {PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.host_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string port = 3;
-    {PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.port_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string token = 4;
-    {PROTOBUF_FIELD_OFFSET(GetChatServerRsp, _impl_.token_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\30\0\4\4\5\0\0\0"
-    "message.GetChatServerRsp"
-    "host"
-    "port"
-    "token"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetChatServerRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.GetChatServerRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.host_.ClearToEmpty();
-  _impl_.port_.ClearToEmpty();
-  _impl_.token_.ClearToEmpty();
-  _impl_.error_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetChatServerRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetChatServerRsp& this_ = static_cast<const GetChatServerRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetChatServerRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetChatServerRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.GetChatServerRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // string host = 2;
-          if (!this_._internal_host().empty()) {
-            const std::string& _s = this_._internal_host();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.GetChatServerRsp.host");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string port = 3;
-          if (!this_._internal_port().empty()) {
-            const std::string& _s = this_._internal_port();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.GetChatServerRsp.port");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string token = 4;
-          if (!this_._internal_token().empty()) {
-            const std::string& _s = this_._internal_token();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.GetChatServerRsp.token");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.GetChatServerRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetChatServerRsp::ByteSizeLong(const MessageLite& base) {
-          const GetChatServerRsp& this_ = static_cast<const GetChatServerRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetChatServerRsp::ByteSizeLong() const {
-          const GetChatServerRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.GetChatServerRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string host = 2;
-            if (!this_._internal_host().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_host());
-            }
-            // string port = 3;
-            if (!this_._internal_port().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_port());
-            }
-            // string token = 4;
-            if (!this_._internal_token().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_token());
-            }
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetChatServerRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetChatServerRsp*>(&to_msg);
-  auto& from = static_cast<const GetChatServerRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.GetChatServerRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_host().empty()) {
-    _this->_internal_set_host(from._internal_host());
-  }
-  if (!from._internal_port().empty()) {
-    _this->_internal_set_port(from._internal_port());
-  }
-  if (!from._internal_token().empty()) {
-    _this->_internal_set_token(from._internal_token());
-  }
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetChatServerRsp::CopyFrom(const GetChatServerRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.GetChatServerRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetChatServerRsp::InternalSwap(GetChatServerRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.host_, &other->_impl_.host_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.port_, &other->_impl_.port_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
-        swap(_impl_.error_, other->_impl_.error_);
-}
-
-::google::protobuf::Metadata GetChatServerRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class LoginReq::_Internal {
- public:
-};
-
-LoginReq::LoginReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.LoginReq)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::LoginReq& from_msg)
-      : token_(arena, from.token_),
-        _cached_size_{0} {}
-
-LoginReq::LoginReq(
-    ::google::protobuf::Arena* arena,
-    const LoginReq& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  LoginReq* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.uid_ = from._impl_.uid_;
-
-  // @@protoc_insertion_point(copy_constructor:message.LoginReq)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : token_(arena),
-        _cached_size_{0} {}
-
-inline void LoginReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.uid_ = {};
-}
-LoginReq::~LoginReq() {
-  // @@protoc_insertion_point(destructor:message.LoginReq)
-  SharedDtor(*this);
-}
-inline void LoginReq::SharedDtor(MessageLite& self) {
-  LoginReq& this_ = static_cast<LoginReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.token_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* LoginReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) LoginReq(arena);
-}
-constexpr auto LoginReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(LoginReq),
-                                            alignof(LoginReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull LoginReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_LoginReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &LoginReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<LoginReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &LoginReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<LoginReq>(), &LoginReq::ByteSizeLong,
-            &LoginReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(LoginReq, _impl_._cached_size_),
-        false,
-    },
-    &LoginReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* LoginReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 30, 2> LoginReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::LoginReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string token = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(LoginReq, _impl_.token_)}},
-    // int32 uid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(LoginReq, _impl_.uid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(LoginReq, _impl_.uid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 uid = 1;
-    {PROTOBUF_FIELD_OFFSET(LoginReq, _impl_.uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string token = 2;
-    {PROTOBUF_FIELD_OFFSET(LoginReq, _impl_.token_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\20\0\5\0\0\0\0\0"
-    "message.LoginReq"
-    "token"
-  }},
-};
-
-PROTOBUF_NOINLINE void LoginReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.LoginReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.token_.ClearToEmpty();
-  _impl_.uid_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* LoginReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const LoginReq& this_ = static_cast<const LoginReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* LoginReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const LoginReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.LoginReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 uid = 1;
-          if (this_._internal_uid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_uid(), target);
-          }
-
-          // string token = 2;
-          if (!this_._internal_token().empty()) {
-            const std::string& _s = this_._internal_token();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.LoginReq.token");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.LoginReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t LoginReq::ByteSizeLong(const MessageLite& base) {
-          const LoginReq& this_ = static_cast<const LoginReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t LoginReq::ByteSizeLong() const {
-          const LoginReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.LoginReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string token = 2;
-            if (!this_._internal_token().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_token());
-            }
-            // int32 uid = 1;
-            if (this_._internal_uid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_uid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void LoginReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<LoginReq*>(&to_msg);
-  auto& from = static_cast<const LoginReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.LoginReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_token().empty()) {
-    _this->_internal_set_token(from._internal_token());
-  }
-  if (from._internal_uid() != 0) {
-    _this->_impl_.uid_ = from._impl_.uid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void LoginReq::CopyFrom(const LoginReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.LoginReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void LoginReq::InternalSwap(LoginReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
-        swap(_impl_.uid_, other->_impl_.uid_);
-}
-
-::google::protobuf::Metadata LoginReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class LoginRsp::_Internal {
- public:
-};
-
-LoginRsp::LoginRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.LoginRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::LoginRsp& from_msg)
-      : token_(arena, from.token_),
-        _cached_size_{0} {}
-
-LoginRsp::LoginRsp(
-    ::google::protobuf::Arena* arena,
-    const LoginRsp& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  LoginRsp* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, error_),
-           offsetof(Impl_, uid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::uid_));
-
-  // @@protoc_insertion_point(copy_constructor:message.LoginRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : token_(arena),
-        _cached_size_{0} {}
-
-inline void LoginRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           0,
-           offsetof(Impl_, uid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::uid_));
-}
-LoginRsp::~LoginRsp() {
-  // @@protoc_insertion_point(destructor:message.LoginRsp)
-  SharedDtor(*this);
-}
-inline void LoginRsp::SharedDtor(MessageLite& self) {
-  LoginRsp& this_ = static_cast<LoginRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.token_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* LoginRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) LoginRsp(arena);
-}
-constexpr auto LoginRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(LoginRsp),
-                                            alignof(LoginRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull LoginRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_LoginRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &LoginRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<LoginRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &LoginRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<LoginRsp>(), &LoginRsp::ByteSizeLong,
-            &LoginRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_._cached_size_),
-        false,
-    },
-    &LoginRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* LoginRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 30, 2> LoginRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::LoginRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(LoginRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.error_)}},
-    // int32 uid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(LoginRsp, _impl_.uid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.uid_)}},
-    // string token = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.token_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 uid = 2;
-    {PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string token = 3;
-    {PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.token_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\20\0\0\5\0\0\0\0"
-    "message.LoginRsp"
-    "token"
-  }},
-};
-
-PROTOBUF_NOINLINE void LoginRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.LoginRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.token_.ClearToEmpty();
-  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.uid_) -
-      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.uid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* LoginRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const LoginRsp& this_ = static_cast<const LoginRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* LoginRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const LoginRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.LoginRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // int32 uid = 2;
-          if (this_._internal_uid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_uid(), target);
-          }
-
-          // string token = 3;
-          if (!this_._internal_token().empty()) {
-            const std::string& _s = this_._internal_token();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.LoginRsp.token");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.LoginRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t LoginRsp::ByteSizeLong(const MessageLite& base) {
-          const LoginRsp& this_ = static_cast<const LoginRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t LoginRsp::ByteSizeLong() const {
-          const LoginRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.LoginRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string token = 3;
-            if (!this_._internal_token().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_token());
-            }
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-            // int32 uid = 2;
-            if (this_._internal_uid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_uid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void LoginRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<LoginRsp*>(&to_msg);
-  auto& from = static_cast<const LoginRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.LoginRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_token().empty()) {
-    _this->_internal_set_token(from._internal_token());
-  }
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  if (from._internal_uid() != 0) {
-    _this->_impl_.uid_ = from._impl_.uid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void LoginRsp::CopyFrom(const LoginRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.LoginRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void LoginRsp::InternalSwap(LoginRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.uid_)
-      + sizeof(LoginRsp::_impl_.uid_)
-      - PROTOBUF_FIELD_OFFSET(LoginRsp, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
-}
-
-::google::protobuf::Metadata LoginRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AddFriendReq::_Internal {
- public:
-};
-
-AddFriendReq::AddFriendReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.AddFriendReq)
-}
-inline PROTOBUF_NDEBUG_INLINE AddFriendReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::AddFriendReq& from_msg)
-      : name_(arena, from.name_),
-        desc_(arena, from.desc_),
-        icon_(arena, from.icon_),
-        nick_(arena, from.nick_),
-        _cached_size_{0} {}
-
-AddFriendReq::AddFriendReq(
-    ::google::protobuf::Arena* arena,
-    const AddFriendReq& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AddFriendReq* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, applyuid_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, applyuid_),
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, applyuid_) +
-               sizeof(Impl_::touid_));
-
-  // @@protoc_insertion_point(copy_constructor:message.AddFriendReq)
-}
-inline PROTOBUF_NDEBUG_INLINE AddFriendReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : name_(arena),
-        desc_(arena),
-        icon_(arena),
-        nick_(arena),
-        _cached_size_{0} {}
-
-inline void AddFriendReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, applyuid_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, applyuid_) +
-               sizeof(Impl_::touid_));
-}
-AddFriendReq::~AddFriendReq() {
-  // @@protoc_insertion_point(destructor:message.AddFriendReq)
-  SharedDtor(*this);
-}
-inline void AddFriendReq::SharedDtor(MessageLite& self) {
-  AddFriendReq& this_ = static_cast<AddFriendReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.name_.Destroy();
-  this_._impl_.desc_.Destroy();
-  this_._impl_.icon_.Destroy();
-  this_._impl_.nick_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* AddFriendReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AddFriendReq(arena);
-}
-constexpr auto AddFriendReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AddFriendReq),
-                                            alignof(AddFriendReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AddFriendReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AddFriendReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AddFriendReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AddFriendReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AddFriendReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AddFriendReq>(), &AddFriendReq::ByteSizeLong,
-            &AddFriendReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_._cached_size_),
-        false,
-    },
-    &AddFriendReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AddFriendReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 7, 0, 45, 2> AddFriendReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    7, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967168,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    7,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::AddFriendReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 applyuid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddFriendReq, _impl_.applyuid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.applyuid_)}},
-    // string name = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.name_)}},
-    // string desc = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.desc_)}},
-    // string icon = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.icon_)}},
-    // string nick = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.nick_)}},
-    // int32 sex = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddFriendReq, _impl_.sex_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.sex_)}},
-    // int32 touid = 7;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddFriendReq, _impl_.touid_), 63>(),
-     {56, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.touid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 applyuid = 1;
-    {PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.applyuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string name = 2;
-    {PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string desc = 3;
-    {PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.desc_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string icon = 4;
-    {PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.icon_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string nick = 5;
-    {PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.nick_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 sex = 6;
-    {PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.sex_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 7;
-    {PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\24\0\4\4\4\4\0\0"
-    "message.AddFriendReq"
-    "name"
-    "desc"
-    "icon"
-    "nick"
-  }},
-};
-
-PROTOBUF_NOINLINE void AddFriendReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.AddFriendReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.name_.ClearToEmpty();
-  _impl_.desc_.ClearToEmpty();
-  _impl_.icon_.ClearToEmpty();
-  _impl_.nick_.ClearToEmpty();
-  ::memset(&_impl_.applyuid_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.applyuid_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AddFriendReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AddFriendReq& this_ = static_cast<const AddFriendReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AddFriendReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AddFriendReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.AddFriendReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 applyuid = 1;
-          if (this_._internal_applyuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_applyuid(), target);
-          }
-
-          // string name = 2;
-          if (!this_._internal_name().empty()) {
-            const std::string& _s = this_._internal_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.AddFriendReq.name");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string desc = 3;
-          if (!this_._internal_desc().empty()) {
-            const std::string& _s = this_._internal_desc();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.AddFriendReq.desc");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string icon = 4;
-          if (!this_._internal_icon().empty()) {
-            const std::string& _s = this_._internal_icon();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.AddFriendReq.icon");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string nick = 5;
-          if (!this_._internal_nick().empty()) {
-            const std::string& _s = this_._internal_nick();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.AddFriendReq.nick");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // int32 sex = 6;
-          if (this_._internal_sex() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<6>(
-                    stream, this_._internal_sex(), target);
-          }
-
-          // int32 touid = 7;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<7>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.AddFriendReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AddFriendReq::ByteSizeLong(const MessageLite& base) {
-          const AddFriendReq& this_ = static_cast<const AddFriendReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AddFriendReq::ByteSizeLong() const {
-          const AddFriendReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.AddFriendReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string name = 2;
-            if (!this_._internal_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_name());
-            }
-            // string desc = 3;
-            if (!this_._internal_desc().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_desc());
-            }
-            // string icon = 4;
-            if (!this_._internal_icon().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_icon());
-            }
-            // string nick = 5;
-            if (!this_._internal_nick().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_nick());
-            }
-            // int32 applyuid = 1;
-            if (this_._internal_applyuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_applyuid());
-            }
-            // int32 sex = 6;
-            if (this_._internal_sex() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_sex());
-            }
-            // int32 touid = 7;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AddFriendReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AddFriendReq*>(&to_msg);
-  auto& from = static_cast<const AddFriendReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.AddFriendReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_name().empty()) {
-    _this->_internal_set_name(from._internal_name());
-  }
-  if (!from._internal_desc().empty()) {
-    _this->_internal_set_desc(from._internal_desc());
-  }
-  if (!from._internal_icon().empty()) {
-    _this->_internal_set_icon(from._internal_icon());
-  }
-  if (!from._internal_nick().empty()) {
-    _this->_internal_set_nick(from._internal_nick());
-  }
-  if (from._internal_applyuid() != 0) {
-    _this->_impl_.applyuid_ = from._impl_.applyuid_;
-  }
-  if (from._internal_sex() != 0) {
-    _this->_impl_.sex_ = from._impl_.sex_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AddFriendReq::CopyFrom(const AddFriendReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.AddFriendReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AddFriendReq::InternalSwap(AddFriendReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.desc_, &other->_impl_.desc_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.icon_, &other->_impl_.icon_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.nick_, &other->_impl_.nick_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.touid_)
-      + sizeof(AddFriendReq::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(AddFriendReq, _impl_.applyuid_)>(
-          reinterpret_cast<char*>(&_impl_.applyuid_),
-          reinterpret_cast<char*>(&other->_impl_.applyuid_));
-}
-
-::google::protobuf::Metadata AddFriendReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AddFriendRsp::_Internal {
- public:
-};
-
-AddFriendRsp::AddFriendRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.AddFriendRsp)
-}
-AddFriendRsp::AddFriendRsp(
-    ::google::protobuf::Arena* arena, const AddFriendRsp& from)
-    : AddFriendRsp(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE AddFriendRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void AddFriendRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::touid_));
-}
-AddFriendRsp::~AddFriendRsp() {
-  // @@protoc_insertion_point(destructor:message.AddFriendRsp)
-  SharedDtor(*this);
-}
-inline void AddFriendRsp::SharedDtor(MessageLite& self) {
-  AddFriendRsp& this_ = static_cast<AddFriendRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* AddFriendRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AddFriendRsp(arena);
-}
-constexpr auto AddFriendRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(AddFriendRsp),
-                                            alignof(AddFriendRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AddFriendRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AddFriendRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AddFriendRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AddFriendRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AddFriendRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AddFriendRsp>(), &AddFriendRsp::ByteSizeLong,
-            &AddFriendRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_._cached_size_),
-        false,
-    },
-    &AddFriendRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AddFriendRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2> AddFriendRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::AddFriendRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddFriendRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.error_)}},
-    // int32 applyuid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddFriendRsp, _impl_.applyuid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.applyuid_)}},
-    // int32 touid = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddFriendRsp, _impl_.touid_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.touid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 applyuid = 2;
-    {PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.applyuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 3;
-    {PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void AddFriendRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.AddFriendRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AddFriendRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AddFriendRsp& this_ = static_cast<const AddFriendRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AddFriendRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AddFriendRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.AddFriendRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // int32 applyuid = 2;
-          if (this_._internal_applyuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_applyuid(), target);
-          }
-
-          // int32 touid = 3;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.AddFriendRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AddFriendRsp::ByteSizeLong(const MessageLite& base) {
-          const AddFriendRsp& this_ = static_cast<const AddFriendRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AddFriendRsp::ByteSizeLong() const {
-          const AddFriendRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.AddFriendRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-            // int32 applyuid = 2;
-            if (this_._internal_applyuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_applyuid());
-            }
-            // int32 touid = 3;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AddFriendRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AddFriendRsp*>(&to_msg);
-  auto& from = static_cast<const AddFriendRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.AddFriendRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  if (from._internal_applyuid() != 0) {
-    _this->_impl_.applyuid_ = from._impl_.applyuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AddFriendRsp::CopyFrom(const AddFriendRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.AddFriendRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AddFriendRsp::InternalSwap(AddFriendRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.touid_)
-      + sizeof(AddFriendRsp::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(AddFriendRsp, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
-}
-
-::google::protobuf::Metadata AddFriendRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RplyFriendReq::_Internal {
- public:
-};
-
-RplyFriendReq::RplyFriendReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.RplyFriendReq)
-}
-RplyFriendReq::RplyFriendReq(
-    ::google::protobuf::Arena* arena, const RplyFriendReq& from)
-    : RplyFriendReq(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE RplyFriendReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void RplyFriendReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, rplyuid_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, rplyuid_) +
-               sizeof(Impl_::touid_));
-}
-RplyFriendReq::~RplyFriendReq() {
-  // @@protoc_insertion_point(destructor:message.RplyFriendReq)
-  SharedDtor(*this);
-}
-inline void RplyFriendReq::SharedDtor(MessageLite& self) {
-  RplyFriendReq& this_ = static_cast<RplyFriendReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* RplyFriendReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RplyFriendReq(arena);
-}
-constexpr auto RplyFriendReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(RplyFriendReq),
-                                            alignof(RplyFriendReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RplyFriendReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RplyFriendReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RplyFriendReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RplyFriendReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RplyFriendReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RplyFriendReq>(), &RplyFriendReq::ByteSizeLong,
-            &RplyFriendReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_._cached_size_),
-        false,
-    },
-    &RplyFriendReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RplyFriendReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2> RplyFriendReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::RplyFriendReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 rplyuid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RplyFriendReq, _impl_.rplyuid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.rplyuid_)}},
-    // bool agree = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(RplyFriendReq, _impl_.agree_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.agree_)}},
-    // int32 touid = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RplyFriendReq, _impl_.touid_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.touid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 rplyuid = 1;
-    {PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.rplyuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // bool agree = 2;
-    {PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.agree_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // int32 touid = 3;
-    {PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void RplyFriendReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.RplyFriendReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.rplyuid_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.rplyuid_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RplyFriendReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RplyFriendReq& this_ = static_cast<const RplyFriendReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RplyFriendReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RplyFriendReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.RplyFriendReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 rplyuid = 1;
-          if (this_._internal_rplyuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_rplyuid(), target);
-          }
-
-          // bool agree = 2;
-          if (this_._internal_agree() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                2, this_._internal_agree(), target);
-          }
-
-          // int32 touid = 3;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.RplyFriendReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RplyFriendReq::ByteSizeLong(const MessageLite& base) {
-          const RplyFriendReq& this_ = static_cast<const RplyFriendReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RplyFriendReq::ByteSizeLong() const {
-          const RplyFriendReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.RplyFriendReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 rplyuid = 1;
-            if (this_._internal_rplyuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_rplyuid());
-            }
-            // bool agree = 2;
-            if (this_._internal_agree() != 0) {
-              total_size += 2;
-            }
-            // int32 touid = 3;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RplyFriendReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RplyFriendReq*>(&to_msg);
-  auto& from = static_cast<const RplyFriendReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.RplyFriendReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_rplyuid() != 0) {
-    _this->_impl_.rplyuid_ = from._impl_.rplyuid_;
-  }
-  if (from._internal_agree() != 0) {
-    _this->_impl_.agree_ = from._impl_.agree_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RplyFriendReq::CopyFrom(const RplyFriendReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.RplyFriendReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RplyFriendReq::InternalSwap(RplyFriendReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.touid_)
-      + sizeof(RplyFriendReq::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(RplyFriendReq, _impl_.rplyuid_)>(
-          reinterpret_cast<char*>(&_impl_.rplyuid_),
-          reinterpret_cast<char*>(&other->_impl_.rplyuid_));
-}
-
-::google::protobuf::Metadata RplyFriendReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RplyFriendRsp::_Internal {
- public:
-};
-
-RplyFriendRsp::RplyFriendRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.RplyFriendRsp)
-}
-RplyFriendRsp::RplyFriendRsp(
-    ::google::protobuf::Arena* arena, const RplyFriendRsp& from)
-    : RplyFriendRsp(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE RplyFriendRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void RplyFriendRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::touid_));
-}
-RplyFriendRsp::~RplyFriendRsp() {
-  // @@protoc_insertion_point(destructor:message.RplyFriendRsp)
-  SharedDtor(*this);
-}
-inline void RplyFriendRsp::SharedDtor(MessageLite& self) {
-  RplyFriendRsp& this_ = static_cast<RplyFriendRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* RplyFriendRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RplyFriendRsp(arena);
-}
-constexpr auto RplyFriendRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(RplyFriendRsp),
-                                            alignof(RplyFriendRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RplyFriendRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RplyFriendRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RplyFriendRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RplyFriendRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RplyFriendRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RplyFriendRsp>(), &RplyFriendRsp::ByteSizeLong,
-            &RplyFriendRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_._cached_size_),
-        false,
-    },
-    &RplyFriendRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RplyFriendRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2> RplyFriendRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::RplyFriendRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RplyFriendRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.error_)}},
-    // int32 rplyuid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RplyFriendRsp, _impl_.rplyuid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.rplyuid_)}},
-    // int32 touid = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RplyFriendRsp, _impl_.touid_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.touid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 rplyuid = 2;
-    {PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.rplyuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 3;
-    {PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void RplyFriendRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.RplyFriendRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RplyFriendRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RplyFriendRsp& this_ = static_cast<const RplyFriendRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RplyFriendRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RplyFriendRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.RplyFriendRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // int32 rplyuid = 2;
-          if (this_._internal_rplyuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_rplyuid(), target);
-          }
-
-          // int32 touid = 3;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.RplyFriendRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RplyFriendRsp::ByteSizeLong(const MessageLite& base) {
-          const RplyFriendRsp& this_ = static_cast<const RplyFriendRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RplyFriendRsp::ByteSizeLong() const {
-          const RplyFriendRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.RplyFriendRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-            // int32 rplyuid = 2;
-            if (this_._internal_rplyuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_rplyuid());
-            }
-            // int32 touid = 3;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RplyFriendRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RplyFriendRsp*>(&to_msg);
-  auto& from = static_cast<const RplyFriendRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.RplyFriendRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  if (from._internal_rplyuid() != 0) {
-    _this->_impl_.rplyuid_ = from._impl_.rplyuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RplyFriendRsp::CopyFrom(const RplyFriendRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.RplyFriendRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RplyFriendRsp::InternalSwap(RplyFriendRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.touid_)
-      + sizeof(RplyFriendRsp::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(RplyFriendRsp, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
-}
-
-::google::protobuf::Metadata RplyFriendRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SendChatMsgReq::_Internal {
- public:
-};
-
-SendChatMsgReq::SendChatMsgReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.SendChatMsgReq)
-}
-inline PROTOBUF_NDEBUG_INLINE SendChatMsgReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::SendChatMsgReq& from_msg)
-      : message_(arena, from.message_),
-        _cached_size_{0} {}
-
-SendChatMsgReq::SendChatMsgReq(
-    ::google::protobuf::Arena* arena,
-    const SendChatMsgReq& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SendChatMsgReq* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, fromuid_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, fromuid_),
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, fromuid_) +
-               sizeof(Impl_::touid_));
-
-  // @@protoc_insertion_point(copy_constructor:message.SendChatMsgReq)
-}
-inline PROTOBUF_NDEBUG_INLINE SendChatMsgReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : message_(arena),
-        _cached_size_{0} {}
-
-inline void SendChatMsgReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, fromuid_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, fromuid_) +
-               sizeof(Impl_::touid_));
-}
-SendChatMsgReq::~SendChatMsgReq() {
-  // @@protoc_insertion_point(destructor:message.SendChatMsgReq)
-  SharedDtor(*this);
-}
-inline void SendChatMsgReq::SharedDtor(MessageLite& self) {
-  SendChatMsgReq& this_ = static_cast<SendChatMsgReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.message_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* SendChatMsgReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SendChatMsgReq(arena);
-}
-constexpr auto SendChatMsgReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SendChatMsgReq),
-                                            alignof(SendChatMsgReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SendChatMsgReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SendChatMsgReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SendChatMsgReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SendChatMsgReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SendChatMsgReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SendChatMsgReq>(), &SendChatMsgReq::ByteSizeLong,
-            &SendChatMsgReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_._cached_size_),
-        false,
-    },
-    &SendChatMsgReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SendChatMsgReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 38, 2> SendChatMsgReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::SendChatMsgReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 fromuid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SendChatMsgReq, _impl_.fromuid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.fromuid_)}},
-    // int32 touid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SendChatMsgReq, _impl_.touid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.touid_)}},
-    // string message = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.message_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 fromuid = 1;
-    {PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.fromuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 2;
-    {PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string message = 3;
-    {PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.message_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\0\0\7\0\0\0\0"
-    "message.SendChatMsgReq"
-    "message"
-  }},
-};
-
-PROTOBUF_NOINLINE void SendChatMsgReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.SendChatMsgReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.message_.ClearToEmpty();
-  ::memset(&_impl_.fromuid_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.fromuid_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SendChatMsgReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SendChatMsgReq& this_ = static_cast<const SendChatMsgReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SendChatMsgReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SendChatMsgReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.SendChatMsgReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 fromuid = 1;
-          if (this_._internal_fromuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_fromuid(), target);
-          }
-
-          // int32 touid = 2;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          // string message = 3;
-          if (!this_._internal_message().empty()) {
-            const std::string& _s = this_._internal_message();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.SendChatMsgReq.message");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.SendChatMsgReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SendChatMsgReq::ByteSizeLong(const MessageLite& base) {
-          const SendChatMsgReq& this_ = static_cast<const SendChatMsgReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SendChatMsgReq::ByteSizeLong() const {
-          const SendChatMsgReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.SendChatMsgReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string message = 3;
-            if (!this_._internal_message().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_message());
-            }
-            // int32 fromuid = 1;
-            if (this_._internal_fromuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_fromuid());
-            }
-            // int32 touid = 2;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SendChatMsgReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SendChatMsgReq*>(&to_msg);
-  auto& from = static_cast<const SendChatMsgReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.SendChatMsgReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_message().empty()) {
-    _this->_internal_set_message(from._internal_message());
-  }
-  if (from._internal_fromuid() != 0) {
-    _this->_impl_.fromuid_ = from._impl_.fromuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SendChatMsgReq::CopyFrom(const SendChatMsgReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.SendChatMsgReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SendChatMsgReq::InternalSwap(SendChatMsgReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.message_, &other->_impl_.message_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.touid_)
-      + sizeof(SendChatMsgReq::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(SendChatMsgReq, _impl_.fromuid_)>(
-          reinterpret_cast<char*>(&_impl_.fromuid_),
-          reinterpret_cast<char*>(&other->_impl_.fromuid_));
-}
-
-::google::protobuf::Metadata SendChatMsgReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SendChatMsgRsp::_Internal {
- public:
-};
-
-SendChatMsgRsp::SendChatMsgRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.SendChatMsgRsp)
-}
-SendChatMsgRsp::SendChatMsgRsp(
-    ::google::protobuf::Arena* arena, const SendChatMsgRsp& from)
-    : SendChatMsgRsp(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE SendChatMsgRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void SendChatMsgRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::touid_));
-}
-SendChatMsgRsp::~SendChatMsgRsp() {
-  // @@protoc_insertion_point(destructor:message.SendChatMsgRsp)
-  SharedDtor(*this);
-}
-inline void SendChatMsgRsp::SharedDtor(MessageLite& self) {
-  SendChatMsgRsp& this_ = static_cast<SendChatMsgRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* SendChatMsgRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SendChatMsgRsp(arena);
-}
-constexpr auto SendChatMsgRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(SendChatMsgRsp),
-                                            alignof(SendChatMsgRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SendChatMsgRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SendChatMsgRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SendChatMsgRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SendChatMsgRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SendChatMsgRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SendChatMsgRsp>(), &SendChatMsgRsp::ByteSizeLong,
-            &SendChatMsgRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_._cached_size_),
-        false,
-    },
-    &SendChatMsgRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SendChatMsgRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2> SendChatMsgRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::SendChatMsgRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SendChatMsgRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.error_)}},
-    // int32 fromuid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SendChatMsgRsp, _impl_.fromuid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.fromuid_)}},
-    // int32 touid = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SendChatMsgRsp, _impl_.touid_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.touid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 fromuid = 2;
-    {PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.fromuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 3;
-    {PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void SendChatMsgRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.SendChatMsgRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SendChatMsgRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SendChatMsgRsp& this_ = static_cast<const SendChatMsgRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SendChatMsgRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SendChatMsgRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.SendChatMsgRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // int32 fromuid = 2;
-          if (this_._internal_fromuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_fromuid(), target);
-          }
-
-          // int32 touid = 3;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.SendChatMsgRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SendChatMsgRsp::ByteSizeLong(const MessageLite& base) {
-          const SendChatMsgRsp& this_ = static_cast<const SendChatMsgRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SendChatMsgRsp::ByteSizeLong() const {
-          const SendChatMsgRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.SendChatMsgRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-            // int32 fromuid = 2;
-            if (this_._internal_fromuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_fromuid());
-            }
-            // int32 touid = 3;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SendChatMsgRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SendChatMsgRsp*>(&to_msg);
-  auto& from = static_cast<const SendChatMsgRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.SendChatMsgRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  if (from._internal_fromuid() != 0) {
-    _this->_impl_.fromuid_ = from._impl_.fromuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SendChatMsgRsp::CopyFrom(const SendChatMsgRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.SendChatMsgRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SendChatMsgRsp::InternalSwap(SendChatMsgRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.touid_)
-      + sizeof(SendChatMsgRsp::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(SendChatMsgRsp, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
-}
-
-::google::protobuf::Metadata SendChatMsgRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AuthFriendReq::_Internal {
- public:
-};
-
-AuthFriendReq::AuthFriendReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.AuthFriendReq)
-}
-AuthFriendReq::AuthFriendReq(
-    ::google::protobuf::Arena* arena, const AuthFriendReq& from)
-    : AuthFriendReq(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE AuthFriendReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void AuthFriendReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, fromuid_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, fromuid_) +
-               sizeof(Impl_::touid_));
-}
-AuthFriendReq::~AuthFriendReq() {
-  // @@protoc_insertion_point(destructor:message.AuthFriendReq)
-  SharedDtor(*this);
-}
-inline void AuthFriendReq::SharedDtor(MessageLite& self) {
-  AuthFriendReq& this_ = static_cast<AuthFriendReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* AuthFriendReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AuthFriendReq(arena);
-}
-constexpr auto AuthFriendReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(AuthFriendReq),
-                                            alignof(AuthFriendReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AuthFriendReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AuthFriendReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AuthFriendReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AuthFriendReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AuthFriendReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AuthFriendReq>(), &AuthFriendReq::ByteSizeLong,
-            &AuthFriendReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AuthFriendReq, _impl_._cached_size_),
-        false,
-    },
-    &AuthFriendReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AuthFriendReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 0, 2> AuthFriendReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::AuthFriendReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 touid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AuthFriendReq, _impl_.touid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(AuthFriendReq, _impl_.touid_)}},
-    // int32 fromuid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AuthFriendReq, _impl_.fromuid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AuthFriendReq, _impl_.fromuid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 fromuid = 1;
-    {PROTOBUF_FIELD_OFFSET(AuthFriendReq, _impl_.fromuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 2;
-    {PROTOBUF_FIELD_OFFSET(AuthFriendReq, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void AuthFriendReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.AuthFriendReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.fromuid_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.fromuid_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AuthFriendReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AuthFriendReq& this_ = static_cast<const AuthFriendReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AuthFriendReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AuthFriendReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.AuthFriendReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 fromuid = 1;
-          if (this_._internal_fromuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_fromuid(), target);
-          }
-
-          // int32 touid = 2;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.AuthFriendReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AuthFriendReq::ByteSizeLong(const MessageLite& base) {
-          const AuthFriendReq& this_ = static_cast<const AuthFriendReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AuthFriendReq::ByteSizeLong() const {
-          const AuthFriendReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.AuthFriendReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 fromuid = 1;
-            if (this_._internal_fromuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_fromuid());
-            }
-            // int32 touid = 2;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AuthFriendReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AuthFriendReq*>(&to_msg);
-  auto& from = static_cast<const AuthFriendReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.AuthFriendReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_fromuid() != 0) {
-    _this->_impl_.fromuid_ = from._impl_.fromuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AuthFriendReq::CopyFrom(const AuthFriendReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.AuthFriendReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AuthFriendReq::InternalSwap(AuthFriendReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AuthFriendReq, _impl_.touid_)
-      + sizeof(AuthFriendReq::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(AuthFriendReq, _impl_.fromuid_)>(
-          reinterpret_cast<char*>(&_impl_.fromuid_),
-          reinterpret_cast<char*>(&other->_impl_.fromuid_));
-}
-
-::google::protobuf::Metadata AuthFriendReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AuthFriendRsp::_Internal {
- public:
-};
-
-AuthFriendRsp::AuthFriendRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.AuthFriendRsp)
-}
-AuthFriendRsp::AuthFriendRsp(
-    ::google::protobuf::Arena* arena, const AuthFriendRsp& from)
-    : AuthFriendRsp(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE AuthFriendRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void AuthFriendRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::touid_));
-}
-AuthFriendRsp::~AuthFriendRsp() {
-  // @@protoc_insertion_point(destructor:message.AuthFriendRsp)
-  SharedDtor(*this);
-}
-inline void AuthFriendRsp::SharedDtor(MessageLite& self) {
-  AuthFriendRsp& this_ = static_cast<AuthFriendRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* AuthFriendRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AuthFriendRsp(arena);
-}
-constexpr auto AuthFriendRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(AuthFriendRsp),
-                                            alignof(AuthFriendRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AuthFriendRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AuthFriendRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AuthFriendRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AuthFriendRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AuthFriendRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AuthFriendRsp>(), &AuthFriendRsp::ByteSizeLong,
-            &AuthFriendRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_._cached_size_),
-        false,
-    },
-    &AuthFriendRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AuthFriendRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2> AuthFriendRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::AuthFriendRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AuthFriendRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.error_)}},
-    // int32 fromuid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AuthFriendRsp, _impl_.fromuid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.fromuid_)}},
-    // int32 touid = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AuthFriendRsp, _impl_.touid_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.touid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 fromuid = 2;
-    {PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.fromuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 3;
-    {PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void AuthFriendRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.AuthFriendRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AuthFriendRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AuthFriendRsp& this_ = static_cast<const AuthFriendRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AuthFriendRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AuthFriendRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.AuthFriendRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // int32 fromuid = 2;
-          if (this_._internal_fromuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_fromuid(), target);
-          }
-
-          // int32 touid = 3;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.AuthFriendRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AuthFriendRsp::ByteSizeLong(const MessageLite& base) {
-          const AuthFriendRsp& this_ = static_cast<const AuthFriendRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AuthFriendRsp::ByteSizeLong() const {
-          const AuthFriendRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.AuthFriendRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-            // int32 fromuid = 2;
-            if (this_._internal_fromuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_fromuid());
-            }
-            // int32 touid = 3;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AuthFriendRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AuthFriendRsp*>(&to_msg);
-  auto& from = static_cast<const AuthFriendRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.AuthFriendRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  if (from._internal_fromuid() != 0) {
-    _this->_impl_.fromuid_ = from._impl_.fromuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AuthFriendRsp::CopyFrom(const AuthFriendRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.AuthFriendRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AuthFriendRsp::InternalSwap(AuthFriendRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.touid_)
-      + sizeof(AuthFriendRsp::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(AuthFriendRsp, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
-}
-
-::google::protobuf::Metadata AuthFriendRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class TextChatMsgReq::_Internal {
- public:
-};
-
-TextChatMsgReq::TextChatMsgReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.TextChatMsgReq)
-}
-inline PROTOBUF_NDEBUG_INLINE TextChatMsgReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::TextChatMsgReq& from_msg)
-      : textmsgs_{visibility, arena, from.textmsgs_},
-        _cached_size_{0} {}
-
-TextChatMsgReq::TextChatMsgReq(
-    ::google::protobuf::Arena* arena,
-    const TextChatMsgReq& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TextChatMsgReq* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, fromuid_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, fromuid_),
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, fromuid_) +
-               sizeof(Impl_::touid_));
-
-  // @@protoc_insertion_point(copy_constructor:message.TextChatMsgReq)
-}
-inline PROTOBUF_NDEBUG_INLINE TextChatMsgReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : textmsgs_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void TextChatMsgReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, fromuid_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, fromuid_) +
-               sizeof(Impl_::touid_));
-}
-TextChatMsgReq::~TextChatMsgReq() {
-  // @@protoc_insertion_point(destructor:message.TextChatMsgReq)
-  SharedDtor(*this);
-}
-inline void TextChatMsgReq::SharedDtor(MessageLite& self) {
-  TextChatMsgReq& this_ = static_cast<TextChatMsgReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* TextChatMsgReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TextChatMsgReq(arena);
-}
-constexpr auto TextChatMsgReq::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.textmsgs_) +
-          decltype(TextChatMsgReq::_impl_.textmsgs_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(TextChatMsgReq), alignof(TextChatMsgReq), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&TextChatMsgReq::PlacementNew_,
-                                 sizeof(TextChatMsgReq),
-                                 alignof(TextChatMsgReq));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TextChatMsgReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TextChatMsgReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TextChatMsgReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TextChatMsgReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TextChatMsgReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TextChatMsgReq>(), &TextChatMsgReq::ByteSizeLong,
-            &TextChatMsgReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_._cached_size_),
-        false,
-    },
-    &TextChatMsgReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TextChatMsgReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 0, 2> TextChatMsgReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::TextChatMsgReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 fromuid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TextChatMsgReq, _impl_.fromuid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.fromuid_)}},
-    // int32 touid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TextChatMsgReq, _impl_.touid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.touid_)}},
-    // repeated .message.TextChatData textmsgs = 3;
-    {::_pbi::TcParser::FastMtR1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.textmsgs_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 fromuid = 1;
-    {PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.fromuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 2;
-    {PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // repeated .message.TextChatData textmsgs = 3;
-    {PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.textmsgs_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::message::TextChatData>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void TextChatMsgReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.TextChatMsgReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.textmsgs_.Clear();
-  ::memset(&_impl_.fromuid_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.fromuid_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TextChatMsgReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TextChatMsgReq& this_ = static_cast<const TextChatMsgReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TextChatMsgReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TextChatMsgReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.TextChatMsgReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 fromuid = 1;
-          if (this_._internal_fromuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_fromuid(), target);
-          }
-
-          // int32 touid = 2;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          // repeated .message.TextChatData textmsgs = 3;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_textmsgs_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_textmsgs().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    3, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.TextChatMsgReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TextChatMsgReq::ByteSizeLong(const MessageLite& base) {
-          const TextChatMsgReq& this_ = static_cast<const TextChatMsgReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TextChatMsgReq::ByteSizeLong() const {
-          const TextChatMsgReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.TextChatMsgReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .message.TextChatData textmsgs = 3;
-            {
-              total_size += 1UL * this_._internal_textmsgs_size();
-              for (const auto& msg : this_._internal_textmsgs()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int32 fromuid = 1;
-            if (this_._internal_fromuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_fromuid());
-            }
-            // int32 touid = 2;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TextChatMsgReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TextChatMsgReq*>(&to_msg);
-  auto& from = static_cast<const TextChatMsgReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.TextChatMsgReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_textmsgs()->MergeFrom(
-      from._internal_textmsgs());
-  if (from._internal_fromuid() != 0) {
-    _this->_impl_.fromuid_ = from._impl_.fromuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TextChatMsgReq::CopyFrom(const TextChatMsgReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.TextChatMsgReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TextChatMsgReq::InternalSwap(TextChatMsgReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.textmsgs_.InternalSwap(&other->_impl_.textmsgs_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.touid_)
-      + sizeof(TextChatMsgReq::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.fromuid_)>(
-          reinterpret_cast<char*>(&_impl_.fromuid_),
-          reinterpret_cast<char*>(&other->_impl_.fromuid_));
-}
-
-::google::protobuf::Metadata TextChatMsgReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class TextChatData::_Internal {
- public:
-};
-
-TextChatData::TextChatData(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.TextChatData)
-}
-inline PROTOBUF_NDEBUG_INLINE TextChatData::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::TextChatData& from_msg)
-      : msgid_(arena, from.msgid_),
-        msgcontent_(arena, from.msgcontent_),
-        _cached_size_{0} {}
-
-TextChatData::TextChatData(
-    ::google::protobuf::Arena* arena,
-    const TextChatData& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TextChatData* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:message.TextChatData)
-}
-inline PROTOBUF_NDEBUG_INLINE TextChatData::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : msgid_(arena),
-        msgcontent_(arena),
-        _cached_size_{0} {}
-
-inline void TextChatData::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-TextChatData::~TextChatData() {
-  // @@protoc_insertion_point(destructor:message.TextChatData)
-  SharedDtor(*this);
-}
-inline void TextChatData::SharedDtor(MessageLite& self) {
-  TextChatData& this_ = static_cast<TextChatData&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.msgid_.Destroy();
-  this_._impl_.msgcontent_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* TextChatData::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TextChatData(arena);
-}
-constexpr auto TextChatData::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TextChatData),
-                                            alignof(TextChatData));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TextChatData::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TextChatData_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TextChatData::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TextChatData>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TextChatData::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TextChatData>(), &TextChatData::ByteSizeLong,
-            &TextChatData::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TextChatData, _impl_._cached_size_),
-        false,
-    },
-    &TextChatData::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TextChatData::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 44, 2> TextChatData::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::TextChatData>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string msgcontent = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatData, _impl_.msgcontent_)}},
-    // string msgid = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatData, _impl_.msgid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string msgid = 1;
-    {PROTOBUF_FIELD_OFFSET(TextChatData, _impl_.msgid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string msgcontent = 2;
-    {PROTOBUF_FIELD_OFFSET(TextChatData, _impl_.msgcontent_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\24\5\12\0\0\0\0\0"
-    "message.TextChatData"
-    "msgid"
-    "msgcontent"
-  }},
-};
-
-PROTOBUF_NOINLINE void TextChatData::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.TextChatData)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.msgid_.ClearToEmpty();
-  _impl_.msgcontent_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TextChatData::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TextChatData& this_ = static_cast<const TextChatData&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TextChatData::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TextChatData& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.TextChatData)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string msgid = 1;
-          if (!this_._internal_msgid().empty()) {
-            const std::string& _s = this_._internal_msgid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.TextChatData.msgid");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string msgcontent = 2;
-          if (!this_._internal_msgcontent().empty()) {
-            const std::string& _s = this_._internal_msgcontent();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "message.TextChatData.msgcontent");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.TextChatData)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TextChatData::ByteSizeLong(const MessageLite& base) {
-          const TextChatData& this_ = static_cast<const TextChatData&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TextChatData::ByteSizeLong() const {
-          const TextChatData& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.TextChatData)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string msgid = 1;
-            if (!this_._internal_msgid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msgid());
-            }
-            // string msgcontent = 2;
-            if (!this_._internal_msgcontent().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msgcontent());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TextChatData::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TextChatData*>(&to_msg);
-  auto& from = static_cast<const TextChatData&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.TextChatData)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_msgid().empty()) {
-    _this->_internal_set_msgid(from._internal_msgid());
-  }
-  if (!from._internal_msgcontent().empty()) {
-    _this->_internal_set_msgcontent(from._internal_msgcontent());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TextChatData::CopyFrom(const TextChatData& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.TextChatData)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TextChatData::InternalSwap(TextChatData* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msgid_, &other->_impl_.msgid_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msgcontent_, &other->_impl_.msgcontent_, arena);
-}
-
-::google::protobuf::Metadata TextChatData::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class TextChatMsgRsp::_Internal {
- public:
-};
-
-TextChatMsgRsp::TextChatMsgRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.TextChatMsgRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE TextChatMsgRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::message::TextChatMsgRsp& from_msg)
-      : textmsgs_{visibility, arena, from.textmsgs_},
-        _cached_size_{0} {}
-
-TextChatMsgRsp::TextChatMsgRsp(
-    ::google::protobuf::Arena* arena,
-    const TextChatMsgRsp& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TextChatMsgRsp* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, error_),
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::touid_));
-
-  // @@protoc_insertion_point(copy_constructor:message.TextChatMsgRsp)
-}
-inline PROTOBUF_NDEBUG_INLINE TextChatMsgRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : textmsgs_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void TextChatMsgRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           0,
-           offsetof(Impl_, touid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::touid_));
-}
-TextChatMsgRsp::~TextChatMsgRsp() {
-  // @@protoc_insertion_point(destructor:message.TextChatMsgRsp)
-  SharedDtor(*this);
-}
-inline void TextChatMsgRsp::SharedDtor(MessageLite& self) {
-  TextChatMsgRsp& this_ = static_cast<TextChatMsgRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* TextChatMsgRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TextChatMsgRsp(arena);
-}
-constexpr auto TextChatMsgRsp::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.textmsgs_) +
-          decltype(TextChatMsgRsp::_impl_.textmsgs_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(TextChatMsgRsp), alignof(TextChatMsgRsp), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&TextChatMsgRsp::PlacementNew_,
-                                 sizeof(TextChatMsgRsp),
-                                 alignof(TextChatMsgRsp));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TextChatMsgRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TextChatMsgRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TextChatMsgRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TextChatMsgRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TextChatMsgRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TextChatMsgRsp>(), &TextChatMsgRsp::ByteSizeLong,
-            &TextChatMsgRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_._cached_size_),
-        false,
-    },
-    &TextChatMsgRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TextChatMsgRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> TextChatMsgRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::TextChatMsgRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .message.TextChatData textmsgs = 4;
-    {::_pbi::TcParser::FastMtR1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.textmsgs_)}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TextChatMsgRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.error_)}},
-    // int32 fromuid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TextChatMsgRsp, _impl_.fromuid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.fromuid_)}},
-    // int32 touid = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TextChatMsgRsp, _impl_.touid_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.touid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 fromuid = 2;
-    {PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.fromuid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 touid = 3;
-    {PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.touid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // repeated .message.TextChatData textmsgs = 4;
-    {PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.textmsgs_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::message::TextChatData>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void TextChatMsgRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.TextChatMsgRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.textmsgs_.Clear();
-  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.touid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TextChatMsgRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TextChatMsgRsp& this_ = static_cast<const TextChatMsgRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TextChatMsgRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TextChatMsgRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.TextChatMsgRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // int32 fromuid = 2;
-          if (this_._internal_fromuid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_fromuid(), target);
-          }
-
-          // int32 touid = 3;
-          if (this_._internal_touid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_touid(), target);
-          }
-
-          // repeated .message.TextChatData textmsgs = 4;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_textmsgs_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_textmsgs().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    4, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.TextChatMsgRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TextChatMsgRsp::ByteSizeLong(const MessageLite& base) {
-          const TextChatMsgRsp& this_ = static_cast<const TextChatMsgRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TextChatMsgRsp::ByteSizeLong() const {
-          const TextChatMsgRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.TextChatMsgRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .message.TextChatData textmsgs = 4;
-            {
-              total_size += 1UL * this_._internal_textmsgs_size();
-              for (const auto& msg : this_._internal_textmsgs()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-            // int32 fromuid = 2;
-            if (this_._internal_fromuid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_fromuid());
-            }
-            // int32 touid = 3;
-            if (this_._internal_touid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_touid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TextChatMsgRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TextChatMsgRsp*>(&to_msg);
-  auto& from = static_cast<const TextChatMsgRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.TextChatMsgRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_textmsgs()->MergeFrom(
-      from._internal_textmsgs());
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  if (from._internal_fromuid() != 0) {
-    _this->_impl_.fromuid_ = from._impl_.fromuid_;
-  }
-  if (from._internal_touid() != 0) {
-    _this->_impl_.touid_ = from._impl_.touid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TextChatMsgRsp::CopyFrom(const TextChatMsgRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.TextChatMsgRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TextChatMsgRsp::InternalSwap(TextChatMsgRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.textmsgs_.InternalSwap(&other->_impl_.textmsgs_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.touid_)
-      + sizeof(TextChatMsgRsp::_impl_.touid_)
-      - PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
-}
-
-::google::protobuf::Metadata TextChatMsgRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class KickUserReq::_Internal {
- public:
-};
-
-KickUserReq::KickUserReq(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.KickUserReq)
-}
-KickUserReq::KickUserReq(
-    ::google::protobuf::Arena* arena, const KickUserReq& from)
-    : KickUserReq(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void KickUserReq::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.uid_ = {};
-}
-KickUserReq::~KickUserReq() {
-  // @@protoc_insertion_point(destructor:message.KickUserReq)
-  SharedDtor(*this);
-}
-inline void KickUserReq::SharedDtor(MessageLite& self) {
-  KickUserReq& this_ = static_cast<KickUserReq&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* KickUserReq::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) KickUserReq(arena);
-}
-constexpr auto KickUserReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(KickUserReq),
-                                            alignof(KickUserReq));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull KickUserReq::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_KickUserReq_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &KickUserReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<KickUserReq>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &KickUserReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<KickUserReq>(), &KickUserReq::ByteSizeLong,
-            &KickUserReq::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_._cached_size_),
-        false,
-    },
-    &KickUserReq::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* KickUserReq::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> KickUserReq::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::KickUserReq>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 uid = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserReq, _impl_.uid_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 uid = 1;
-    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void KickUserReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.KickUserReq)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.uid_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* KickUserReq::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const KickUserReq& this_ = static_cast<const KickUserReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* KickUserReq::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const KickUserReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.KickUserReq)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 uid = 1;
-          if (this_._internal_uid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_uid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.KickUserReq)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t KickUserReq::ByteSizeLong(const MessageLite& base) {
-          const KickUserReq& this_ = static_cast<const KickUserReq&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t KickUserReq::ByteSizeLong() const {
-          const KickUserReq& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.KickUserReq)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // int32 uid = 1;
-            if (this_._internal_uid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_uid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void KickUserReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<KickUserReq*>(&to_msg);
-  auto& from = static_cast<const KickUserReq&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.KickUserReq)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_uid() != 0) {
-    _this->_impl_.uid_ = from._impl_.uid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void KickUserReq::CopyFrom(const KickUserReq& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.KickUserReq)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void KickUserReq::InternalSwap(KickUserReq* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.uid_, other->_impl_.uid_);
-}
-
-::google::protobuf::Metadata KickUserReq::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class KickUserRsp::_Internal {
- public:
-};
-
-KickUserRsp::KickUserRsp(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:message.KickUserRsp)
-}
-KickUserRsp::KickUserRsp(
-    ::google::protobuf::Arena* arena, const KickUserRsp& from)
-    : KickUserRsp(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE KickUserRsp::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void KickUserRsp::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, error_),
-           0,
-           offsetof(Impl_, uid_) -
-               offsetof(Impl_, error_) +
-               sizeof(Impl_::uid_));
-}
-KickUserRsp::~KickUserRsp() {
-  // @@protoc_insertion_point(destructor:message.KickUserRsp)
-  SharedDtor(*this);
-}
-inline void KickUserRsp::SharedDtor(MessageLite& self) {
-  KickUserRsp& this_ = static_cast<KickUserRsp&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* KickUserRsp::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) KickUserRsp(arena);
-}
-constexpr auto KickUserRsp::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(KickUserRsp),
-                                            alignof(KickUserRsp));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull KickUserRsp::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_KickUserRsp_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &KickUserRsp::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<KickUserRsp>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &KickUserRsp::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<KickUserRsp>(), &KickUserRsp::ByteSizeLong,
-            &KickUserRsp::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(KickUserRsp, _impl_._cached_size_),
-        false,
-    },
-    &KickUserRsp::kDescriptorMethods,
-    &descriptor_table_message_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* KickUserRsp::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 0, 2> KickUserRsp::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::message::KickUserRsp>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 uid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserRsp, _impl_.uid_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserRsp, _impl_.uid_)}},
-    // int32 error = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserRsp, _impl_.error_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserRsp, _impl_.error_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 error = 1;
-    {PROTOBUF_FIELD_OFFSET(KickUserRsp, _impl_.error_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 uid = 2;
-    {PROTOBUF_FIELD_OFFSET(KickUserRsp, _impl_.uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void KickUserRsp::Clear() {
-// @@protoc_insertion_point(message_clear_start:message.KickUserRsp)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.uid_) -
-      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.uid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* KickUserRsp::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const KickUserRsp& this_ = static_cast<const KickUserRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* KickUserRsp::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const KickUserRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:message.KickUserRsp)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 error = 1;
-          if (this_._internal_error() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_error(), target);
-          }
-
-          // int32 uid = 2;
-          if (this_._internal_uid() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_uid(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:message.KickUserRsp)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t KickUserRsp::ByteSizeLong(const MessageLite& base) {
-          const KickUserRsp& this_ = static_cast<const KickUserRsp&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t KickUserRsp::ByteSizeLong() const {
-          const KickUserRsp& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:message.KickUserRsp)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 error = 1;
-            if (this_._internal_error() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_error());
-            }
-            // int32 uid = 2;
-            if (this_._internal_uid() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_uid());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void KickUserRsp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<KickUserRsp*>(&to_msg);
-  auto& from = static_cast<const KickUserRsp&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:message.KickUserRsp)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_error() != 0) {
-    _this->_impl_.error_ = from._impl_.error_;
-  }
-  if (from._internal_uid() != 0) {
-    _this->_impl_.uid_ = from._impl_.uid_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void KickUserRsp::CopyFrom(const KickUserRsp& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:message.KickUserRsp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void KickUserRsp::InternalSwap(KickUserRsp* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(KickUserRsp, _impl_.uid_)
-      + sizeof(KickUserRsp::_impl_.uid_)
-      - PROTOBUF_FIELD_OFFSET(KickUserRsp, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
-}
-
-::google::protobuf::Metadata KickUserRsp::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace message
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_message_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -17,6 +17,7 @@ SOURCES += \
     logindialog.cpp \
     main.cpp \
     mainwindow.cpp \
+    payloadcodec.cpp \
     registerdialog.cpp \
     resetdialog.cpp \
     tcpmgr.cpp \
@@ -30,6 +31,8 @@ HEADERS += \
     httpmgr.h \
     logindialog.h \
     mainwindow.h \
+    msgdispatch.h \
+    payloadcodec.h \
     registerdialog.h \
     resetdialog.h \
     singleton.h \
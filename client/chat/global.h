@@ -44,6 +44,7 @@ enum ReqId{
     ID_NOTIFY_OFF_LINE_REQ = 1021, //通知用户下线
     ID_HEART_BEAT_REQ = 1023,      //心跳请求
     ID_HEARTBEAT_RSP = 1024,       //心跳回复
+    ID_NOTIFY_OFFLINE_MSG_BATCH = 1025, //登录后批量补发离线消息
 };
 
 enum Modules{
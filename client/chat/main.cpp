@@ -2,6 +2,7 @@
 
 #include <QApplication>
 #include <QFile>
+#include "tcpmgr.h"
 
 int main(int argc, char *argv[])
 {
@@ -34,6 +35,8 @@ int main(int argc, char *argv[])
     QString gate_host = settings.value("GateServer/host").toString();
     QString gate_port = settings.value("GateServer/port").toString();
     gate_url_prefix = "http://" + gate_host + ":" + gate_port;
+    // [ChatServer] Payload=protobuf 时与聊天服务使用二进制负载
+    TcpMgr::GetInstance()->SetBinaryPayload(settings.value("ChatServer/Payload").toString() == "protobuf");
 
     MainWindow w;
     w.show();
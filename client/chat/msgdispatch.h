@@ -0,0 +1,43 @@
+#ifndef MSGDISPATCH_H
+#define MSGDISPATCH_H
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+// 消息 id 到处理函数的稠密表，按 id - MinId 直接下标查找，与 chatserver 的 MsgDispatchTable 一致。
+// 表在编译期由注册列表构造，范围外或重复的 id 会导致编译失败
+template <typename Handler, int MinId, int MaxId>
+class MsgDispatchTable
+{
+public:
+    struct Route {
+        int id;
+        Handler handler;
+    };
+
+    constexpr MsgDispatchTable(std::initializer_list<Route> routes):_handlers{} {
+        for (const auto& route : routes) {
+            if (!InRange(route.id) || _handlers[Index(route.id)] != nullptr) {
+                throw "invalid or duplicate msg id in dispatch table";
+            }
+            _handlers[Index(route.id)] = route.handler;
+        }
+    }
+
+    constexpr Handler Find(int id) const {
+        return InRange(id) ? _handlers[Index(id)] : nullptr;
+    }
+
+private:
+    static constexpr bool InRange(int id) {
+        return id >= MinId && id <= MaxId;
+    }
+
+    static constexpr std::size_t Index(int id) {
+        return static_cast<std::size_t>(id - MinId);
+    }
+
+    std::array<Handler, MaxId - MinId + 1> _handlers;
+};
+
+#endif // MSGDISPATCH_H
@@ -0,0 +1,282 @@
+#include "payloadcodec.h"
+#include <QJsonArray>
+
+bool PayloadCodec::IsBinaryMsg(ReqId id)
+{
+    return schemaOf(id) != nullptr;
+}
+
+// 字段号需与 chatserver/message.proto 保持一致
+const QVector<PayloadCodec::FieldDesc>* PayloadCodec::schemaOf(ReqId id)
+{
+    // TextChatData
+    static const QVector<FieldDesc> text_data = {
+        {1, "msgid", FIELD_STRING, nullptr},
+        {2, "content", FIELD_STRING, nullptr},
+    };
+    // ChatUserInfo
+    static const QVector<FieldDesc> user_info = {
+        {1, "uid", FIELD_INT32, nullptr},
+        {2, "name", FIELD_STRING, nullptr},
+        {3, "nick", FIELD_STRING, nullptr},
+        {4, "icon", FIELD_STRING, nullptr},
+        {5, "sex", FIELD_INT32, nullptr},
+        {6, "desc", FIELD_STRING, nullptr},
+        {7, "back", FIELD_STRING, nullptr},
+        {8, "status", FIELD_INT32, nullptr},
+    };
+    // ChatLoginReq
+    static const QVector<FieldDesc> login_req = {
+        {1, "uid", FIELD_INT32, nullptr},
+        {2, "token", FIELD_STRING, nullptr},
+    };
+    // ChatLoginRsp
+    static const QVector<FieldDesc> login_rsp = {
+        {1, "error", FIELD_INT32, nullptr},
+        {2, "uid", FIELD_INT32, nullptr},
+        {3, "pwd", FIELD_STRING, nullptr},
+        {4, "name", FIELD_STRING, nullptr},
+        {5, "email", FIELD_STRING, nullptr},
+        {6, "nick", FIELD_STRING, nullptr},
+        {7, "desc", FIELD_STRING, nullptr},
+        {8, "sex", FIELD_INT32, nullptr},
+        {9, "icon", FIELD_STRING, nullptr},
+        {10, "apply_list", FIELD_MESSAGE_LIST, &user_info},
+        {11, "friend_list", FIELD_MESSAGE_LIST, &user_info},
+    };
+    // TextChatMsgReq
+    static const QVector<FieldDesc> text_req = {
+        {1, "fromuid", FIELD_INT32, nullptr},
+        {2, "touid", FIELD_INT32, nullptr},
+        {3, "text_array", FIELD_MESSAGE_LIST, &text_data},
+    };
+    // TextChatMsgRsp，应答和通知共用
+    static const QVector<FieldDesc> text_rsp = {
+        {1, "error", FIELD_INT32, nullptr},
+        {2, "fromuid", FIELD_INT32, nullptr},
+        {3, "touid", FIELD_INT32, nullptr},
+        {4, "text_array", FIELD_MESSAGE_LIST, &text_data},
+    };
+    // AddFriendNotify
+    static const QVector<FieldDesc> add_friend_notify = {
+        {1, "error", FIELD_INT32, nullptr},
+        {2, "applyuid", FIELD_INT32, nullptr},
+        {3, "name", FIELD_STRING, nullptr},
+        {4, "desc", FIELD_STRING, nullptr},
+        {5, "icon", FIELD_STRING, nullptr},
+        {6, "nick", FIELD_STRING, nullptr},
+        {7, "sex", FIELD_INT32, nullptr},
+    };
+    // AuthFriendNotify
+    static const QVector<FieldDesc> auth_friend_notify = {
+        {1, "error", FIELD_INT32, nullptr},
+        {2, "fromuid", FIELD_INT32, nullptr},
+        {3, "touid", FIELD_INT32, nullptr},
+        {4, "name", FIELD_STRING, nullptr},
+        {5, "nick", FIELD_STRING, nullptr},
+        {6, "icon", FIELD_STRING, nullptr},
+        {7, "sex", FIELD_INT32, nullptr},
+    };
+    // KickUserRsp
+    static const QVector<FieldDesc> offline_notify = {
+        {1, "error", FIELD_INT32, nullptr},
+        {2, "uid", FIELD_INT32, nullptr},
+    };
+    // HeartBeatReq
+    static const QVector<FieldDesc> heartbeat_req = {
+        {1, "fromuid", FIELD_INT32, nullptr},
+    };
+    // HeartBeatRsp
+    static const QVector<FieldDesc> heartbeat_rsp = {
+        {1, "error", FIELD_INT32, nullptr},
+    };
+
+    switch (id) {
+    case ID_CHAT_LOGIN:
+        return &login_req;
+    case ID_CHAT_LOGIN_RSP:
+        return &login_rsp;
+    case ID_TEXT_CHAT_MSG_REQ:
+        return &text_req;
+    case ID_TEXT_CHAT_MSG_RSP:
+    case ID_NOTIFY_TEXT_CHAT_MSG_REQ:
+        return &text_rsp;
+    case ID_NOTIFY_ADD_FRIEND_REQ:
+        return &add_friend_notify;
+    case ID_NOTIFY_AUTH_FRIEND_REQ:
+        return &auth_friend_notify;
+    case ID_NOTIFY_OFF_LINE_REQ:
+        return &offline_notify;
+    case ID_HEART_BEAT_REQ:
+        return &heartbeat_req;
+    case ID_HEARTBEAT_RSP:
+        return &heartbeat_rsp;
+    default:
+        return nullptr;
+    }
+}
+
+bool PayloadCodec::Encode(ReqId id, const QJsonObject& obj, QByteArray& out)
+{
+    auto schema = schemaOf(id);
+    if (schema == nullptr) {
+        return false;
+    }
+
+    out = encodeMessage(obj, *schema);
+    return true;
+}
+
+bool PayloadCodec::Decode(ReqId id, const QByteArray& data, QJsonObject& out)
+{
+    auto schema = schemaOf(id);
+    if (schema == nullptr) {
+        return false;
+    }
+
+    return decodeMessage(data, *schema, out);
+}
+
+QByteArray PayloadCodec::encodeMessage(const QJsonObject& obj, const QVector<FieldDesc>& schema)
+{
+    QByteArray out;
+    for (const auto& field : schema) {
+        if (!obj.contains(field.key)) {
+            continue;
+        }
+
+        const QJsonValue value = obj[field.key];
+        switch (field.type) {
+        case FIELD_INT32: {
+            int number = value.toInt();
+            // proto3 默认值不上线
+            if (number == 0) {
+                break;
+            }
+            writeVarint(out, static_cast<quint64>(field.number) << 3);
+            // 负数按 int64 符号扩展编码，与 protobuf 一致
+            writeVarint(out, static_cast<quint64>(static_cast<qint64>(number)));
+            break;
+        }
+        case FIELD_STRING: {
+            QByteArray bytes = value.toString().toUtf8();
+            if (bytes.isEmpty()) {
+                break;
+            }
+            writeVarint(out, (static_cast<quint64>(field.number) << 3) | 2);
+            writeVarint(out, static_cast<quint64>(bytes.size()));
+            out.append(bytes);
+            break;
+        }
+        case FIELD_MESSAGE_LIST: {
+            const QJsonArray array = value.toArray();
+            for (const auto& item : array) {
+                QByteArray bytes = encodeMessage(item.toObject(), *field.sub);
+                writeVarint(out, (static_cast<quint64>(field.number) << 3) | 2);
+                writeVarint(out, static_cast<quint64>(bytes.size()));
+                out.append(bytes);
+            }
+            break;
+        }
+        }
+    }
+    return out;
+}
+
+bool PayloadCodec::decodeMessage(const QByteArray& data, const QVector<FieldDesc>& schema, QJsonObject& out)
+{
+    // 线上省略的默认值先补齐，保证上层的 contains("error") 等判断不变
+    for (const auto& field : schema) {
+        if (field.type == FIELD_INT32) {
+            out[field.key] = 0;
+        } else if (field.type == FIELD_STRING) {
+            out[field.key] = QString();
+        }
+    }
+
+    int pos = 0;
+    while (pos < data.size()) {
+        quint64 key = 0;
+        if (!readVarint(data, pos, key)) {
+            return false;
+        }
+
+        int number = static_cast<int>(key >> 3);
+        int wire_type = static_cast<int>(key & 7);
+        const FieldDesc* field = nullptr;
+        for (const auto& desc : schema) {
+            if (desc.number == number) {
+                field = &desc;
+                break;
+            }
+        }
+
+        if (wire_type == 0) {
+            quint64 value = 0;
+            if (!readVarint(data, pos, value)) {
+                return false;
+            }
+            if (field != nullptr && field->type == FIELD_INT32) {
+                out[field->key] = static_cast<qint32>(value);
+            }
+            continue;
+        }
+
+        if (wire_type == 2) {
+            quint64 len = 0;
+            if (!readVarint(data, pos, len) || len > static_cast<quint64>(data.size() - pos)) {
+                return false;
+            }
+            QByteArray bytes = data.mid(pos, static_cast<int>(len));
+            pos += static_cast<int>(len);
+            if (field == nullptr) {
+                continue;
+            }
+            if (field->type == FIELD_STRING) {
+                out[field->key] = QString::fromUtf8(bytes);
+            } else if (field->type == FIELD_MESSAGE_LIST) {
+                QJsonObject item;
+                if (!decodeMessage(bytes, *field->sub, item)) {
+                    return false;
+                }
+                QJsonArray array = out[field->key].toArray();
+                array.append(item);
+                out[field->key] = array;
+            }
+            continue;
+        }
+
+        // 未知的定长字段直接跳过
+        int skip = wire_type == 1 ? 8 : (wire_type == 5 ? 4 : -1);
+        if (skip < 0 || pos + skip > data.size()) {
+            return false;
+        }
+        pos += skip;
+    }
+    return true;
+}
+
+void PayloadCodec::writeVarint(QByteArray& out, quint64 value)
+{
+    while (value >= 0x80) {
+        out.append(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.append(static_cast<char>(value));
+}
+
+bool PayloadCodec::readVarint(const QByteArray& data, int& pos, quint64& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= data.size()) {
+            return false;
+        }
+        quint8 byte = static_cast<quint8>(data[pos++]);
+        value |= static_cast<quint64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
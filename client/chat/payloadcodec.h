@@ -0,0 +1,41 @@
+#ifndef PAYLOADCODEC_H
+#define PAYLOADCODEC_H
+#include <QByteArray>
+#include <QJsonObject>
+#include <QVector>
+#include "global.h"
+
+/**
+ * @brief 聊天服务二进制负载的编解码，按 chatserver/message.proto 的字段号手写 protobuf 线格式，
+ * 客户端无需链接 protobuf。上层仍然以 QJsonObject 收发，字段名与 JSON 协议一致。
+ */
+class PayloadCodec
+{
+public:
+    // 该消息在二进制会话中是否走 protobuf
+    static bool IsBinaryMsg(ReqId id);
+    static bool Encode(ReqId id, const QJsonObject& obj, QByteArray& out);
+    static bool Decode(ReqId id, const QByteArray& data, QJsonObject& out);
+
+private:
+    enum FieldType {
+        FIELD_INT32,
+        FIELD_STRING,
+        FIELD_MESSAGE_LIST,
+    };
+
+    struct FieldDesc {
+        int number;
+        const char* key;
+        FieldType type;
+        const QVector<FieldDesc>* sub;
+    };
+
+    static const QVector<FieldDesc>* schemaOf(ReqId id);
+    static QByteArray encodeMessage(const QJsonObject& obj, const QVector<FieldDesc>& schema);
+    static bool decodeMessage(const QByteArray& data, const QVector<FieldDesc>& schema, QJsonObject& out);
+    static void writeVarint(QByteArray& out, quint64 value);
+    static bool readVarint(const QByteArray& data, int& pos, quint64& value);
+};
+
+#endif // PAYLOADCODEC_H
@@ -1,8 +1,10 @@
 #include "tcpmgr.h"
 #include <QAbstractSocket>
+#include "payloadcodec.h"
 //#include "usermgr.h"
 
-TcpMgr::TcpMgr():_host(""),_port(0),_b_recv_pending(false),_message_id(0),_message_len(0)
+TcpMgr::TcpMgr():_host(""),_port(0),_b_recv_pending(false),_message_id(0),_message_len(0),
+    _b_binary_payload(false)
 {
     QObject::connect(&_socket, &QTcpSocket::connected, [&]() {
         qDebug() << "Connected to server!";
@@ -97,8 +99,6 @@ TcpMgr::TcpMgr():_host(""),_port(0),_b_recv_pending(false),_message_id(0),_messa
     });
     //连接发送信号用来发送数据
     QObject::connect(this, &TcpMgr::sig_send_data, this, &TcpMgr::slot_send_data);
-    //注册消息
-    initHandlers();
 }
 
 /*void TcpMgr::CloseConnection(){
@@ -108,61 +108,95 @@ TcpMgr::TcpMgr():_host(""),_port(0),_b_recv_pending(false),_message_id(0),_messa
 TcpMgr::~TcpMgr(){
 
 }
-void TcpMgr::initHandlers()
+
+void TcpMgr::SetBinaryPayload(bool binary)
 {
-    //auto self = shared_from_this();
-    _handlers.insert(ID_CHAT_LOGIN_RSP, [this](ReqId id, int len, QByteArray data){
-        Q_UNUSED(len);
-        qDebug()<< "handle id is "<< id ;
-        // 将QByteArray转换为QJsonDocument
-        QJsonDocument jsonDoc = QJsonDocument::fromJson(data);
+    _b_binary_payload = binary;
+}
+// 回包注册表，编译期生成，新增回包在这里加一行并实现对应的成员函数
+constexpr MsgDispatchTable<TcpMsgHandler, ID_GET_VARIFY_CODE, ID_NOTIFY_OFFLINE_MSG_BATCH> TcpMgr::_dispatch = {
+    { ID_CHAT_LOGIN_RSP, &TcpMgr::handleChatLoginRsp },
+    { ID_NOTIFY_OFFLINE_MSG_BATCH, &TcpMgr::handleOfflineMsgBatch },
+};
 
-        // 检查转换是否成功
-        if(jsonDoc.isNull()){
-            qDebug() << "Failed to create QJsonDocument.";
-            return;
-        }
+void TcpMgr::handleChatLoginRsp(ReqId id, int len, QByteArray data)
+{
+    Q_UNUSED(len);
+    qDebug()<< "handle id is "<< id ;
+    // 将QByteArray转换为QJsonDocument
+    QJsonDocument jsonDoc = QJsonDocument::fromJson(data);
+
+    // 检查转换是否成功
+    if(jsonDoc.isNull()){
+        qDebug() << "Failed to create QJsonDocument.";
+        return;
+    }
 
-        QJsonObject jsonObj = jsonDoc.object();
-        qDebug()<< "data jsonobj is " << jsonObj ;
+    QJsonObject jsonObj = jsonDoc.object();
+    qDebug()<< "data jsonobj is " << jsonObj ;
 
-        if(!jsonObj.contains("error")){
-            int err = ErrorCodes::ERR_JSON;
-            qDebug() << "Login Failed, err is Json Parse Err" << err ;
-            emit sig_login_failed(err);
-            return;
-        }
+    if(!jsonObj.contains("error")){
+        int err = ErrorCodes::ERR_JSON;
+        qDebug() << "Login Failed, err is Json Parse Err" << err ;
+        emit sig_login_failed(err);
+        return;
+    }
 
-        int err = jsonObj["error"].toInt();
-        if(err != ErrorCodes::SUCCESS){
-            qDebug() << "Login Failed, err is " << err ;
-            emit sig_login_failed(err);
-            return;
-        }
+    int err = jsonObj["error"].toInt();
+    if(err != ErrorCodes::SUCCESS){
+        qDebug() << "Login Failed, err is " << err ;
+        emit sig_login_failed(err);
+        return;
+    }
 
-        /*auto uid = jsonObj["uid"].toInt();
-        auto name = jsonObj["name"].toString();
-        auto nick = jsonObj["nick"].toString();
-        auto icon = jsonObj["icon"].toString();
-        auto sex = jsonObj["sex"].toInt();
-        auto desc = jsonObj["desc"].toString();
-        auto user_info = std::make_shared<UserInfo>(uid, name, nick, icon, sex,"",desc);
+    /*auto uid = jsonObj["uid"].toInt();
+    auto name = jsonObj["name"].toString();
+    auto nick = jsonObj["nick"].toString();
+    auto icon = jsonObj["icon"].toString();
+    auto sex = jsonObj["sex"].toInt();
+    auto desc = jsonObj["desc"].toString();
+    auto user_info = std::make_shared<UserInfo>(uid, name, nick, icon, sex,"",desc);
+
+    UserMgr::GetInstance()->SetUserInfo(user_info);
+    UserMgr::GetInstance()->SetToken(jsonObj["token"].toString());
+    if(jsonObj.contains("apply_list")){
+        UserMgr::GetInstance()->AppendApplyList(jsonObj["apply_list"].toArray());
+    }
 
-        UserMgr::GetInstance()->SetUserInfo(user_info);
-        UserMgr::GetInstance()->SetToken(jsonObj["token"].toString());
-        if(jsonObj.contains("apply_list")){
-            UserMgr::GetInstance()->AppendApplyList(jsonObj["apply_list"].toArray());
-        }
+    //添加好友列表
+    if (jsonObj.contains("friend_list")) {
+        UserMgr::GetInstance()->AppendFriendList(jsonObj["friend_list"].toArray());
+    }*/
 
-        //添加好友列表
-        if (jsonObj.contains("friend_list")) {
-            UserMgr::GetInstance()->AppendFriendList(jsonObj["friend_list"].toArray());
-        }*/
+    emit sig_swich_chatdlg();
+}
 
-        emit sig_swich_chatdlg();
-    });
+// 离线消息批量帧 {"error":0,"msgs":[{"id":N,"msgid":M,"body":{...}},...]}，
+// 条目固定为 JSON，逐条交给对应通知的处理函数
+void TcpMgr::handleOfflineMsgBatch(ReqId id, int len, QByteArray data)
+{
+    Q_UNUSED(len);
+    QJsonDocument jsonDoc = QJsonDocument::fromJson(data);
+    if(jsonDoc.isNull() || !jsonDoc.isObject()){
+        qDebug() << "Failed to parse offline batch, id is " << id;
+        return;
+    }
 
+    QJsonArray msgs = jsonDoc.object()["msgs"].toArray();
+    for(const auto& value : msgs){
+        QJsonObject entry = value.toObject();
+        auto msg_id = static_cast<ReqId>(entry["msgid"].toInt());
+        auto handler = _dispatch.Find(msg_id);
+        if(handler == nullptr || msg_id == ID_NOTIFY_OFFLINE_MSG_BATCH){
+            qDebug()<< "not found id ["<< msg_id << "] to handle in offline batch";
+            continue;
+        }
+        QByteArray body = QJsonDocument(entry["body"].toObject()).toJson(QJsonDocument::Compact);
+        (this->*handler)(msg_id, body.size(), body);
+    }
+}
 
+// 以下回包暂未启用，启用时改写为成员函数并登记到 _dispatch
     /*_handlers.insert(ID_SEARCH_USER_RSP, [this](ReqId id, int len, QByteArray data) {
         Q_UNUSED(len);
         qDebug() << "handle id is " << id << " data is " << data;
@@ -472,17 +506,26 @@ void TcpMgr::initHandlers()
 
     });*/
 
-}
-
 void TcpMgr::handleMsg(ReqId id, int len, QByteArray data)
 {
-    auto find_iter =  _handlers.find(id);
-    if(find_iter == _handlers.end()){
+    auto handler = _dispatch.Find(id);
+    if(handler == nullptr){
         qDebug()<< "not found id ["<< id << "] to handle";
         return ;
     }
 
-    find_iter.value()(id,len,data);
+    // 二进制会话先把 protobuf 还原成 JSON，处理函数保持不变
+    if(_b_binary_payload && PayloadCodec::IsBinaryMsg(id)){
+        QJsonObject jsonObj;
+        if(!PayloadCodec::Decode(id, data, jsonObj)){
+            qDebug()<< "decode binary payload failed, id is " << id;
+            return;
+        }
+        data = QJsonDocument(jsonObj).toJson(QJsonDocument::Compact);
+        len = data.size();
+    }
+
+    (this->*handler)(id,len,data);
 }
 
 void TcpMgr::slot_tcp_connect(ServerInfo si)
@@ -499,6 +542,13 @@ void TcpMgr::slot_send_data(ReqId reqId, QByteArray dataBytes)
 {
     uint16_t id = reqId;
 
+    // 二进制会话把 JSON 转成 protobuf 再发送，登录包的编码决定整个会话的格式
+    if(_b_binary_payload && PayloadCodec::IsBinaryMsg(reqId)){
+        QByteArray binaryBytes;
+        PayloadCodec::Encode(reqId, QJsonDocument::fromJson(dataBytes).object(), binaryBytes);
+        dataBytes = binaryBytes;
+    }
+
     // 计算长度（使用网络字节序转换）
     quint16 len = static_cast<quint16>(dataBytes.length());
 
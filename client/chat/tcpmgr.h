@@ -7,6 +7,10 @@
 #include <QObject>
 #include "userdata.h"
 #include <QJsonArray>
+#include "msgdispatch.h"
+
+class TcpMgr;
+typedef void (TcpMgr::*TcpMsgHandler)(ReqId id, int len, QByteArray data);
 
 class TcpMgr:public QObject, public Singleton<TcpMgr>,
                public std::enable_shared_from_this<TcpMgr>
@@ -15,11 +19,14 @@ class TcpMgr:public QObject, public Singleton<TcpMgr>,
 public:
     ~ TcpMgr();
     void CloseConnection();
+    // 与 chatserver 协商的负载格式，需在登录前设置
+    void SetBinaryPayload(bool binary);
 private:
     friend class Singleton<TcpMgr>;
     TcpMgr();
-    void initHandlers();
     void handleMsg(ReqId id, int len, QByteArray data);
+    void handleChatLoginRsp(ReqId id, int len, QByteArray data);
+    void handleOfflineMsgBatch(ReqId id, int len, QByteArray data);
     QTcpSocket _socket;
     QString _host;
     uint16_t _port;
@@ -27,7 +34,9 @@ private:
     bool _b_recv_pending;
     quint16 _message_id;
     quint16 _message_len;
-    QMap<ReqId, std::function<void(ReqId id, int len, QByteArray data)>> _handlers;
+    bool _b_binary_payload;
+    // 回包处理函数表，下标即 id - ID_GET_VARIFY_CODE
+    static const MsgDispatchTable<TcpMsgHandler, ID_GET_VARIFY_CODE, ID_NOTIFY_OFFLINE_MSG_BATCH> _dispatch;
 public slots:
     void slot_tcp_connect(ServerInfo);
     void slot_send_data(ReqId reqId, QByteArray data);
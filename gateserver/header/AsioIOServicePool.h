@@ -15,6 +15,8 @@ public:
     AsioIOServicePool& operator=(const AsioIOServicePool&) = delete;
     // 使用 round-robin 的方式返回一个 io_service
     boost::asio::io_context& GetIOService();    //采用轮询的方式选出一个 io_context 供用户注册异步任务
+    boost::asio::io_context& GetIOService(std::size_t index);
+    std::size_t Size();
     void Stop();    //用于释放所有线程和异步服务资源
 private:
     AsioIOServicePool(std::size_t size = 2/*std::thread::hardware_concurrency()*/);
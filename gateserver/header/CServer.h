@@ -7,8 +7,12 @@ public:
 	CServer(boost::asio::io_context& ioc, unsigned short& port);
 	void Start();
 private:
-	tcp::acceptor _acceptor;
+	void StartAccept(std::size_t index);
+	// 单 acceptor 模式只有一个，挂在主 io_context 上；
+	// ReusePort 模式下每个 AsioIOServicePool 的 io_context 各一个，下标一一对应
+	std::vector<std::unique_ptr<tcp::acceptor>> _acceptors;
 	net::io_context& _ioc;
+	bool _b_reuse_port;
 	//tcp::socket _socket;
 };
 
@@ -104,6 +104,8 @@ public:
     bool HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen);
     std::string HGet(const std::string &key, const std::string &hkey);
     bool Del(const std::string &key);
+    // 向频道广播一条消息，返回 false 表示命令执行失败
+    bool Publish(const std::string &channel, const std::string &message);
     bool ExistsKey(const std::string &key);
     void Close();
 private:
@@ -61,4 +61,6 @@ private:
 	std::function<void()> func_;
 };
 
-#define CODEPREFIX "code_"
\ No newline at end of file
+#define CODEPREFIX "code_"
+//用户注册或资料变更后广播 "uid|name" 的频道，chatserver 据此更新用户搜索索引和存在性过滤器
+#define USER_PROFILE_CHANNEL "user_profile"
\ No newline at end of file
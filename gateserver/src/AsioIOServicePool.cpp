@@ -28,6 +28,14 @@ boost::asio::io_context& AsioIOServicePool::GetIOService() {
     return service;
 }
 
+boost::asio::io_context& AsioIOServicePool::GetIOService(std::size_t index) {
+    return _ioServices[index];
+}
+
+std::size_t AsioIOServicePool::Size() {
+    return _ioServices.size();
+}
+
 void AsioIOServicePool::Stop(){
     // 先释放 work_guard，让 run() 有机会返回
     for (auto& work : _works) {
@@ -1,21 +1,66 @@
 #include "CServer.h"
 #include "HttpConnection.h"
 #include "AsioIOServicePool.h"
+#include "ConfigMgr.h"
 
-CServer::CServer(boost::asio::io_context& ioc, unsigned short& port) : _ioc(ioc), 
-_acceptor(ioc, tcp::endpoint(tcp::v4(), port)) {
+#ifdef SO_REUSEPORT
+using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
 
+// 打开并监听一个 acceptor，多 acceptor 模式下由内核在同端口的多个 acceptor 间分发连接
+static std::unique_ptr<tcp::acceptor> MakeAcceptor(net::io_context& ioc, unsigned short port, bool reuse_port_on) {
+	tcp::endpoint endpoint(tcp::v4(), port);
+	auto acceptor = std::make_unique<tcp::acceptor>(ioc);
+	acceptor->open(endpoint.protocol());
+	acceptor->set_option(tcp::acceptor::reuse_address(true));
+#ifdef SO_REUSEPORT
+	if (reuse_port_on) {
+		acceptor->set_option(reuse_port(true));
+	}
+#endif
+	acceptor->bind(endpoint);
+	acceptor->listen();
+	return acceptor;
+}
+
+CServer::CServer(boost::asio::io_context& ioc, unsigned short& port) : _ioc(ioc), _b_reuse_port(false) {
+	auto& cfg = ConfigMgr::Inst();
+	_b_reuse_port = cfg["GateServer"]["ReusePort"] == "true";
+#ifndef SO_REUSEPORT
+	if (_b_reuse_port) {
+		std::cout << "SO_REUSEPORT not supported, fall back to single acceptor" << std::endl;
+		_b_reuse_port = false;
+	}
+#endif
+
+	if (!_b_reuse_port) {
+		_acceptors.push_back(MakeAcceptor(ioc, port, false));
+		return;
+	}
+
+	auto pool = AsioIOServicePool::GetInstance();
+	for (std::size_t i = 0; i < pool->Size(); ++i) {
+		_acceptors.push_back(MakeAcceptor(pool->GetIOService(i), port, true));
+	}
 }
 
 void CServer::Start() {
+	for (std::size_t i = 0; i < _acceptors.size(); ++i) {
+		StartAccept(i);
+	}
+}
+
+void CServer::StartAccept(std::size_t index) {
 	auto self = shared_from_this();
-	auto & io_context = AsioIOServicePool::GetInstance()->GetIOService();
+	// ReusePort 模式下连接留在接受它的线程上，否则轮询分配到线程池
+	auto& io_context = _b_reuse_port ? AsioIOServicePool::GetInstance()->GetIOService(index)
+		: AsioIOServicePool::GetInstance()->GetIOService();
 	std::shared_ptr<HttpConnection> new_con = std::make_shared<HttpConnection>(io_context);
-	_acceptor.async_accept(new_con->GetSocket(), [self, new_con](beast::error_code ec) {
+	_acceptors[index]->async_accept(new_con->GetSocket(), [self, new_con, index](beast::error_code ec) {
 		try {
 			//出错放弃该链接，继续监听其他链接
 			if (ec) {
-				self->Start();
+				self->StartAccept(index);
 				return;
 			}
 
@@ -23,11 +68,11 @@ void CServer::Start() {
 			new_con->Start();
 			
 			//继续监听
-			self->Start();
+			self->StartAccept(index);
 		}
 		catch (std::exception& exp) {
 			std::cout << "exception is " << exp.what() << std::endl;
-			self->Start();
+			self->StartAccept(index);
 		}
 	});
 }
\ No newline at end of file
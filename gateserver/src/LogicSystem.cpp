@@ -120,6 +120,8 @@ LogicSystem::LogicSystem() {
             beast::ostream(connection->_response.body()) << root.dump();
             return true;
         }
+        // 通知各 chatserver 把新用户加入搜索索引和存在性过滤器
+        RedisMgr::GetInstance()->Publish(USER_PROFILE_CHANNEL, std::to_string(uid) + "|" + user);
         root["error"] = 0;
         root["email"] = email;
         root["uid"] = uid;
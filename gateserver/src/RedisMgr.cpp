@@ -244,6 +244,24 @@ bool RedisMgr::Del(const std::string &key)
     return true;
 }
 
+bool RedisMgr::Publish(const std::string &channel, const std::string &message)
+{
+    RedisConnectionGuard conn(_con_pool.get());
+    redisContext* connect = conn.get();
+    if(connect == nullptr) {
+        return false;
+    }
+
+    RedisReplyWrapper reply((redisReply*)redisCommand(connect, "PUBLISH %b %b",
+        channel.data(), channel.size(), message.data(), message.size()));
+
+    if (!reply.get() || reply->type != REDIS_REPLY_INTEGER) {
+        std::cerr << "Execute command [PUBLISH " << channel << "] failed!\n";
+        return false;
+    }
+    return true;
+}
+
 bool RedisMgr::ExistsKey(const std::string &key)
 {
     RedisConnectionGuard conn(_con_pool.get());
@@ -60,6 +60,12 @@ private:
 #define IPCOUNTPREFIX  "ipcount_"
 #define USER_BASE_INFO "ubaseinfo_"
 #define LOGIN_COUNT  "logincount"
+//chatserver 写入的过载标记，field 为服务器名，值为 1 表示过载
+#define SERVER_LOAD  "serverload"
+//SERVER_LOAD 最近一次写入的时间（Unix 秒），chatserver 启动时和每 60 秒写一次
+#define SERVER_LOAD_TIME  "serverloadtime"
+//超过该秒数未刷新的节点视为已宕机，不再分配登录
+#define SERVER_LOAD_STALE_SEC 180
 #define LOCK_COUNT "lockcount"
 
 #define LOCK_TIME_OUT 10
@@ -3,6 +3,8 @@
 #include "const.h"
 #include "RedisMgr.h"
 #include <climits>
+#include <cstdlib>
+#include <ctime>
 
 std::string generate_unique_string() {
 	boost::uuids::uuid uuid = boost::uuids::random_generator()();
@@ -52,40 +54,37 @@ StatusServiceImpl::StatusServiceImpl()
 
 }
 
+// 按登录数选最空闲的服务器，跳过在 SERVER_LOAD 中标记为过载的节点；全部过载时仍按登录数选。
+// 超过 SERVER_LOAD_STALE_SEC 没有刷新负载的节点视为已宕机，直接跳过
 ChatServer StatusServiceImpl::getChatServer() {
 	std::lock_guard<std::mutex> guard(_server_mtx);
-	auto minServer = _servers.begin()->second;
-	
-	//auto count_str = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, minServer.name);
-	//if (count_str.empty()) {
-	//
-	//	minServer.con_count = INT_MAX;
-	//}
-	//else {
-	//	minServer.con_count = std::stoi(count_str);
-	//}
-
-
-	//for ( auto& server : _servers) {
-	//	
-	//	if (server.second.name == minServer.name) {
-	//		continue;
-	//	}
-
-	//	auto count_str = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server.second.name);
-	//	if (count_str.empty()) {
-	//		server.second.con_count = INT_MAX;
-	//	}
-	//	else {
-	//		server.second.con_count = std::stoi(count_str);
-	//	}
-
-	//	if (server.second.con_count < minServer.con_count) {
-	//		minServer = server.second;
-	//	}
-	//}
-
-	return minServer;
+	ChatServer* min_server = nullptr;
+	bool min_overloaded = true;
+	long long now = static_cast<long long>(std::time(nullptr));
+	for (auto& server : _servers) {
+		auto count_str = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server.second.name);
+		if (count_str.empty()) {
+			// 没有登记登录数说明该服务器没有启动
+			continue;
+		}
+		auto time_str = RedisMgr::GetInstance()->HGet(SERVER_LOAD_TIME, server.second.name);
+		if (time_str.empty() || now - std::atoll(time_str.c_str()) > SERVER_LOAD_STALE_SEC) {
+			continue;
+		}
+		server.second.con_count = std::stoi(count_str);
+		bool overloaded = RedisMgr::GetInstance()->HGet(SERVER_LOAD, server.second.name) == "1";
+
+		if (min_server == nullptr || (min_overloaded && !overloaded) ||
+			(min_overloaded == overloaded && server.second.con_count < min_server->con_count)) {
+			min_server = &server.second;
+			min_overloaded = overloaded;
+		}
+	}
+
+	if (min_server == nullptr) {
+		return _servers.begin()->second;
+	}
+	return *min_server;
 }
 
 Status StatusServiceImpl::Login(ServerContext* context, const LoginReq* request, LoginRsp* reply)